@@ -0,0 +1,72 @@
+#ifndef SIMTIME_H
+#define SIMTIME_H
+
+#include <cmath>
+#include <cstdint>
+
+// ====================================================================
+// Representation of simulated time, used for the clock, event times and
+//   process times.
+// Defaults to double, which keeps sub-microsecond resolution for runs of
+//   billions of seconds. Compiling with -DFIXED_POINT_TIME (make TIME=fixed)
+//   switches to FixedTime, 64-bit integer ticks of 2^-30 seconds (about
+//   1 ns): adding and subtracting times is then exact, however large the
+//   clock grows, for runs of up to about 270 years.
+// Sums, differences and comparisons of times work on SimTime directly.
+//   Anything else (rates, ratios, averages) converts with toSeconds first,
+//   and times computed in seconds come back through fromSeconds.
+
+#ifdef FIXED_POINT_TIME
+
+class FixedTime {
+  private:
+    int64_t ticks;
+
+  public:
+    static const int64_t TICKS_PER_SECOND = int64_t(1) << 30;
+
+    FixedTime() : ticks(0) {}
+
+    static FixedTime fromTicks(int64_t ticks) {
+      FixedTime t;
+      t.ticks = ticks;
+      return t;
+    }
+    int64_t getTicks() const { return ticks; }
+
+    FixedTime operator+(FixedTime other) const { return fromTicks(ticks + other.ticks); }
+    FixedTime operator-(FixedTime other) const { return fromTicks(ticks - other.ticks); }
+    FixedTime &operator+=(FixedTime other) { ticks += other.ticks; return *this; }
+    FixedTime &operator-=(FixedTime other) { ticks -= other.ticks; return *this; }
+
+    bool operator==(FixedTime other) const { return ticks == other.ticks; }
+    bool operator!=(FixedTime other) const { return ticks != other.ticks; }
+    bool operator<(FixedTime other) const { return ticks < other.ticks; }
+    bool operator<=(FixedTime other) const { return ticks <= other.ticks; }
+    bool operator>(FixedTime other) const { return ticks > other.ticks; }
+    bool operator>=(FixedTime other) const { return ticks >= other.ticks; }
+};
+
+typedef FixedTime SimTime;
+
+inline double toSeconds(SimTime t) {
+  return double(t.getTicks()) * (1.0 / FixedTime::TICKS_PER_SECOND);
+}
+inline SimTime fromSeconds(double seconds) {
+  return FixedTime::fromTicks(llround(seconds * FixedTime::TICKS_PER_SECOND));
+}
+
+#else
+
+typedef double SimTime;
+
+inline double toSeconds(SimTime t) {
+  return t;
+}
+inline SimTime fromSeconds(double seconds) {
+  return seconds;
+}
+
+#endif // FIXED_POINT_TIME
+
+#endif // SIMTIME_H
@@ -2,6 +2,9 @@
 #define CONFIG_H
 
 #include "endChecker/EndCondition.h"
+#include "events/EventQueueType.h"
+#include "dispatchers/DispatcherType.h"
+#include <string>
 
 // ====================================================================
 // PROGRAM CONFIG VARIABLES
@@ -10,19 +13,45 @@
 const bool PRINT_LIVE_UPDATES = false;  // Print live event updates to console (slows performance)
 const int DEFAULT_LINE_LENGTH = 50;     // Default line length for terminal output
 const int DEFAULT_PADDING = 8;          // Default padding for terminal output
+const bool PRINT_POOL_STATS = false;    // Print peak number of processes and pending events allocated
+const int RQ_LENGTH_HISTOGRAM_BINS = 0; // Print distribution of Ready Queue lengths over this many bins (0 = off)
+const float QUANTILE_ACCURACY = 0.01;   // Print percentiles of turnaround, waiting and response times, accurate to this fraction of the value (0 = off)
+const unsigned long long RANDOM_SEED = 0;  // Seed for the random number generators (0 = seed from the current time)
+const int MAX_REPLICATIONS = 1000;      // Most replications to run when replicating to a target precision
 
 const bool CHOOSE_SCHEDULER = true;      // Prompt user to choose scheduler at runtime
 const bool CHOOSE_NUM_CPUS = true;        // Prompt user to choose number of CPUs at runtime
 const bool CHOOSE_RQ_SETUP = true;        // Prompt user to choose Ready Queue setup at runtime
 const bool CHOOSE_END_CONDITION = true;   // Prompt user to choose end condition at runtime
-
-const int DEFAULT_SCHEDULER = 0;         // Default scheduler if not choosing at runtime (0 = FCFS, 1 = SJF, 2 = SRTF, 3 = HRRN)
+const bool CHOOSE_EVENT_QUEUE = false;    // Prompt user to choose event queue implementation at runtime
+
+const int DEFAULT_SCHEDULER = 0;         // Default scheduler if not choosing at runtime (0 = FCFS, 1 = SJF, 2 = SRTF, 3 = HRRN, 4 = RR, 5 = MLFQ, 6 = Priority)
+const float DEFAULT_RR_QUANTUM = 0.1;     // Default Round Robin time quantum (in seconds) if not choosing at runtime
+const float DEFAULT_QUANTUM = 0;          // Time quantum (in seconds) for the other schedulers, preempting processes that run this long (0 = off)
+const int MLFQ_LEVELS = 8;                // Number of MLFQ priority levels (1 to 64)
+const float MLFQ_BASE_QUANTUM = 0.1;      // MLFQ time quantum (in seconds) at the top level, doubling at each level down
+const float MLFQ_BOOST_PERIOD = 50;       // Seconds between MLFQ boosts of every process to the top level (0 = never)
 const int DEFAULT_NUM_CPUS = 1;           // Default number of CPUs if not choosing at runtime
 const int DEFAULT_RQ_SETUP = 2;           // Default Ready Queue setup if not choosing at runtime (1 = per-CPU RQs, 2 = single global RQ)
+const float PUSH_MIGRATION_INTERVAL = 0;  // Per-CPU RQs only: seconds between pushing processes from the longest Ready Queue to idle CPUs and shorter queues (0 = never)
+const bool PULL_MIGRATION = false;        // Per-CPU RQs only: a CPU whose Ready Queue is empty takes a process from the longest Ready Queue
+const DispatcherType DISPATCHER = RANDOM_DISPATCH;  // Per-CPU RQs only: how arrivals pick a CPU (0 = random, 1 = round robin, 2 = shortest queue, 3 = power of d choices, 4 = least work left)
+const int DISPATCH_CHOICES = 2;           // Number of CPUs sampled by the power of d choices dispatcher
+const float MIGRATION_COST = 0;           // Seconds of service a process needs on top of its own after moving to another CPU (cold cache)
+const std::string CPU_CLASSES = "";        // CPU counts and speeds as count x speed separated by semicolons, e.g. "4x2;12x1" for 4 CPUs twice as fast as the other 12 (empty = all speed 1)
+const std::string PROCESS_AFFINITIES = ""; // Per-CPU RQs only: CPU classes processes may run on as weight:classes separated by semicolons, e.g. "0.3:0;0.7:0+1" (* = any, empty = all any)
 
 const EndCondition DEFAULT_END_CONDITION = PROCESSES_DEPARTED;  // Default end condition if not choosing at runtime (0 = processes arrived, 1 = processes departed, 2 = time limit)
 const int DEFAULT_N = 10000;             // Default number of processes if not choosing at runtime
 const float DEFAULT_TIME_LIMIT = 100;     // Default time limit (in seconds) if not choosing at runtime
 
+const std::string ARRIVAL_DISTRIBUTION = "exp";  // Distribution of inter-arrival times (see generators/Distribution.h)
+const std::string SERVICE_DISTRIBUTION = "exp";  // Distribution of service times (see generators/Distribution.h)
+const std::string TRACE_FILE = "";               // Binary trace to replay arrivals from instead of generating them (empty = generate)
+const std::string PROCESS_CLASSES = "";          // Workload classes as rate/mean/priority[/service distribution[/arrival distribution]] separated by semicolons, e.g. "8/0.1/0;0.5/4/1" (empty = one class from the prompted rate and mean)
+
+const EventQueueType DEFAULT_EVENT_QUEUE = AUTO_QUEUE;  // Default event queue if not choosing at runtime (0 = sorted list, 1 = 4-ary heap, 2 = calendar queue, 3 = list or heap by CPU count)
+const int AUTO_QUEUE_LIST_MAX_CPUS = 128;               // AUTO_QUEUE uses the sorted list up to this many CPUs, where it beats the heap
+
 #endif // CONFIG_H
 
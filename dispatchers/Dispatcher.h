@@ -0,0 +1,18 @@
+#ifndef DISPATCHER_H
+#define DISPATCHER_H
+
+#include "../processes/AffinityMask.h"
+
+// ====================================================================
+// Interface for routing arrivals to CPUs when every CPU has its own
+//   Ready Queue. The arrival runs on the picked CPU if it is idle, and
+//   waits in that CPU's Ready Queue otherwise.
+// Only CPUs in the arrival's affinity mask may be picked.
+class Dispatcher {
+  public:
+    virtual int pickCPU(AffinityMask) = 0;
+
+    virtual ~Dispatcher() = default;
+};
+
+#endif // DISPATCHER_H
@@ -0,0 +1,12 @@
+#ifndef DISPATCHERTYPE_H
+#define DISPATCHERTYPE_H
+
+enum DispatcherType {
+  RANDOM_DISPATCH,
+  ROUND_ROBIN_DISPATCH,
+  SHORTEST_QUEUE_DISPATCH,
+  POWER_OF_D_DISPATCH,
+  LEAST_WORK_DISPATCH,
+};
+
+#endif // DISPATCHERTYPE_H
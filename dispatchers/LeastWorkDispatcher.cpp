@@ -0,0 +1,9 @@
+#include "LeastWorkDispatcher.h"
+
+LeastWorkDispatcher::LeastWorkDispatcher(ReadyQueueList *RQList) {
+  this->RQList = RQList;
+}
+
+int LeastWorkDispatcher::pickCPU(AffinityMask mask) {
+  return RQList->getLeastWorkRQ(mask);
+}
@@ -0,0 +1,23 @@
+#ifndef LEASTWORKDISPATCHER_H
+#define LEASTWORKDISPATCHER_H
+
+#include "Dispatcher.h"
+#include "../processes/ReadyQueueList.h"
+
+// ====================================================================
+// Least work left: sends each arrival to the CPU with the least service
+//   time left in total, over its running process and its Ready Queue.
+// Uses the drain times kept by the Ready Queue List, a lookup in constant
+//   time per CPU class. Drain times are in wall time, so faster CPUs count
+//   as having less work left.
+class LeastWorkDispatcher : public Dispatcher {
+  private:
+    ReadyQueueList *RQList;
+
+  public:
+    LeastWorkDispatcher(ReadyQueueList *);
+
+    int pickCPU(AffinityMask);
+};
+
+#endif // LEASTWORKDISPATCHER_H
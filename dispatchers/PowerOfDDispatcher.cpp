@@ -0,0 +1,23 @@
+#include "PowerOfDDispatcher.h"
+
+PowerOfDDispatcher::PowerOfDDispatcher(RandomGenerator *randGen, CPUList *cpuList, ReadyQueueList *RQList, int numChoices) {
+  this->randGen = randGen;
+  this->cpuList = cpuList;
+  this->RQList = RQList;
+  this->numChoices = numChoices;
+}
+
+int PowerOfDDispatcher::pickCPU(AffinityMask mask) {
+  int numAllowed = cpuList->getNumAllowedCPUs(mask);
+  int best = -1;
+  int bestLoad = 0;
+  for (int i = 0; i < numChoices; i++) {
+    int CPUindex = cpuList->getAllowedCPU(mask, randGen->getRandomIndex(numAllowed));
+    int load = RQList->getRQSize(CPUindex) + (cpuList->isCPUIdle(CPUindex) ? 0 : 1);
+    if (best == -1 || load < bestLoad) {
+      best = CPUindex;
+      bestLoad = load;
+    }
+  }
+  return best;
+}
@@ -0,0 +1,26 @@
+#ifndef POWEROFDDISPATCHER_H
+#define POWEROFDDISPATCHER_H
+
+#include "Dispatcher.h"
+#include "../generators/RandomGenerator.h"
+#include "../processes/CPUList.h"
+#include "../processes/ReadyQueueList.h"
+
+// ====================================================================
+// Power of d choices: samples d allowed CPUs at random (with replacement) and
+//   sends each arrival to the one with the fewest processes, counting the
+//   one running. Ties go to the first CPU sampled.
+class PowerOfDDispatcher : public Dispatcher {
+  private:
+    RandomGenerator *randGen;
+    CPUList *cpuList;
+    ReadyQueueList *RQList;
+    int numChoices;
+
+  public:
+    PowerOfDDispatcher(RandomGenerator *, CPUList *, ReadyQueueList *, int);
+
+    int pickCPU(AffinityMask);
+};
+
+#endif // POWEROFDDISPATCHER_H
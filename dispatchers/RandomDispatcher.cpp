@@ -0,0 +1,10 @@
+#include "RandomDispatcher.h"
+
+RandomDispatcher::RandomDispatcher(RandomGenerator *randGen, CPUList *cpuList) {
+  this->randGen = randGen;
+  this->cpuList = cpuList;
+}
+
+int RandomDispatcher::pickCPU(AffinityMask mask) {
+  return cpuList->getAllowedCPU(mask, randGen->getRandomIndex(cpuList->getNumAllowedCPUs(mask)));
+}
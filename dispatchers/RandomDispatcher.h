@@ -0,0 +1,21 @@
+#ifndef RANDOMDISPATCHER_H
+#define RANDOMDISPATCHER_H
+
+#include "Dispatcher.h"
+#include "../generators/RandomGenerator.h"
+#include "../processes/CPUList.h"
+
+// ====================================================================
+// Sends each arrival to a uniformly random allowed CPU.
+class RandomDispatcher : public Dispatcher {
+  private:
+    RandomGenerator *randGen;
+    CPUList *cpuList;
+
+  public:
+    RandomDispatcher(RandomGenerator *, CPUList *);
+
+    int pickCPU(AffinityMask);
+};
+
+#endif // RANDOMDISPATCHER_H
@@ -0,0 +1,16 @@
+#include "RoundRobinDispatcher.h"
+
+RoundRobinDispatcher::RoundRobinDispatcher(CPUList *cpuList) {
+  this->cpuList = cpuList;
+  nextCPU = 0;
+}
+
+int RoundRobinDispatcher::pickCPU(AffinityMask mask) {
+  while (!cpuList->isCPUAllowed(mask, nextCPU)) {     // Skip to the first CPU of the next class
+    int nextClass = cpuList->getCPUClass(nextCPU) + 1;
+    nextCPU = nextClass == cpuList->getNumClasses() ? 0 : cpuList->getAllowedCPU(cpuList->getClassMask(nextClass), 0);
+  }
+  int CPUindex = nextCPU;
+  nextCPU = nextCPU + 1 == cpuList->getNumCPUs() ? 0 : nextCPU + 1;
+  return CPUindex;
+}
@@ -0,0 +1,21 @@
+#ifndef ROUNDROBINDISPATCHER_H
+#define ROUNDROBINDISPATCHER_H
+
+#include "Dispatcher.h"
+#include "../processes/CPUList.h"
+
+// ====================================================================
+// Sends arrivals to the CPUs in turn, skipping CPUs outside the arrival's
+//   affinity mask.
+class RoundRobinDispatcher : public Dispatcher {
+  private:
+    CPUList *cpuList;
+    int nextCPU;
+
+  public:
+    RoundRobinDispatcher(CPUList *);
+
+    int pickCPU(AffinityMask);
+};
+
+#endif // ROUNDROBINDISPATCHER_H
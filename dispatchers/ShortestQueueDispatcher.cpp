@@ -0,0 +1,15 @@
+#include "ShortestQueueDispatcher.h"
+
+ShortestQueueDispatcher::ShortestQueueDispatcher(RandomGenerator *randGen, CPUList *cpuList, ReadyQueueList *RQList) {
+  this->randGen = randGen;
+  this->cpuList = cpuList;
+  this->RQList = RQList;
+}
+
+int ShortestQueueDispatcher::pickCPU(AffinityMask mask) {
+  int numIdle = cpuList->getNumIdleCPUs(mask);
+  if (numIdle > 0) {
+    return cpuList->getIdleCPU(mask, randGen->getRandomIndex(numIdle));
+  }
+  return RQList->getShortestRQ(mask);     // Every allowed CPU is busy, so the shortest queue has the fewest processes
+}
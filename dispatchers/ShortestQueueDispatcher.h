@@ -0,0 +1,26 @@
+#ifndef SHORTESTQUEUEDISPATCHER_H
+#define SHORTESTQUEUEDISPATCHER_H
+
+#include "Dispatcher.h"
+#include "../generators/RandomGenerator.h"
+#include "../processes/CPUList.h"
+#include "../processes/ReadyQueueList.h"
+
+// ====================================================================
+// Join the shortest queue: sends each arrival to a random idle CPU if
+//   there is one, and otherwise to the CPU with the shortest Ready Queue.
+// Both lookups take constant time per CPU class (see CPUList and
+//   ReadyQueueList).
+class ShortestQueueDispatcher : public Dispatcher {
+  private:
+    RandomGenerator *randGen;
+    CPUList *cpuList;
+    ReadyQueueList *RQList;
+
+  public:
+    ShortestQueueDispatcher(RandomGenerator *, CPUList *, ReadyQueueList *);
+
+    int pickCPU(AffinityMask);
+};
+
+#endif // SHORTESTQUEUEDISPATCHER_H
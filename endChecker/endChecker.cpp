@@ -1,19 +1,19 @@
 #include "endChecker.h"
-#include "../input/InputHandler.h"
 
-EndChecker::EndChecker() {
-  this->endCondition = static_cast<EndCondition>(InputHandler::getInput<int>(InputHandler::END_CONDITION));
+// N is only used for the processes arrived/departed conditions, timeLimit for the time limit condition.
+EndChecker::EndChecker(EndCondition endCondition, int N, float timeLimit) {
+  this->endCondition = endCondition;
   if (endCondition == TIME_LIMIT) {
-    this->timeLimit = InputHandler::getInput<float>(InputHandler::TIME_LIMIT);
+    this->timeLimit = fromSeconds(timeLimit);
     this->N = -1;
   }
   else {
-    this->N = InputHandler::getInput<int>(InputHandler::N);
-    this->timeLimit = -1;
+    this->N = N;
+    this->timeLimit = fromSeconds(-1);
   }
   this->arrivals = 0;
   this->departures = 0;
-  this->clock = 0;
+  this->clock = SimTime();
   this->endConditionMet = false;
 }
 
@@ -21,7 +21,7 @@ bool EndChecker::checkEnd() {
   return endConditionMet;
 }
 
-void EndChecker::logArrival(float clock) {
+void EndChecker::logArrival(SimTime clock) {
   arrivals++;
   this->clock = clock;
 
@@ -33,7 +33,7 @@ void EndChecker::logArrival(float clock) {
   }
 }
 
-void EndChecker::logDeparture(float clock) {
+void EndChecker::logDeparture(SimTime clock) {
   departures++;
   this->clock = clock;
 
@@ -2,26 +2,27 @@
 #define ENDCHECKER_H
 
 #include "EndCondition.h"
+#include "../SimTime.h"
 
 class EndChecker {
   private:
     EndCondition endCondition;
     int N;
-    float timeLimit;
+    SimTime timeLimit;
 
     int arrivals;
     int departures;
-    float clock;
+    SimTime clock;
     
     bool endConditionMet;
 
   public:
-    EndChecker();
+    EndChecker(EndCondition, int, float);
 
     bool checkEnd();
 
-    void logArrival(float);
-    void logDeparture(float);
+    void logArrival(SimTime);
+    void logDeparture(SimTime);
 };
 
 #endif // ENDCHECKER_H
\ No newline at end of file
@@ -0,0 +1,192 @@
+#include "CalendarEventQueue.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+CalendarEventQueue::CalendarEventQueue() {
+  buckets = vector<int>(MIN_BUCKETS, -1);
+  width = 1.0;
+  currentDay = 0;
+  size = 0;
+  nextSeq = 0;
+}
+
+// Orders nodes by ascending time, then newest first.
+bool CalendarEventQueue::before(int a, int b) {
+  const Node &x = nodes[a];
+  const Node &y = nodes[b];
+  return x.event.time < y.event.time || (x.event.time == y.event.time && x.seq > y.seq);
+}
+
+// Day (bucket-width interval since time 0) that time t falls on.
+long long CalendarEventQueue::dayOf(SimTime t) {
+  return (long long)floor(toSeconds(t) / width);
+}
+
+// Links node into its bucket, keeping the bucket sorted.
+void CalendarEventQueue::link(int n) {
+  int b = dayOf(nodes[n].event.time) % buckets.size();
+  nodes[n].bucket = b;
+
+  int p = buckets[b];
+  if (p == -1 || before(n, p)) {
+    nodes[n].prev = -1;
+    nodes[n].next = p;
+    if (p != -1) nodes[p].prev = n;
+    buckets[b] = n;
+    return;
+  }
+  while (nodes[p].next != -1 && !before(n, nodes[p].next)) {
+    p = nodes[p].next;
+  }
+  nodes[n].prev = p;
+  nodes[n].next = nodes[p].next;
+  if (nodes[p].next != -1) nodes[nodes[p].next].prev = n;
+  nodes[p].next = n;
+}
+
+void CalendarEventQueue::unlink(int n) {
+  Node &node = nodes[n];
+  if (node.prev != -1) {
+    nodes[node.prev].next = node.next;
+  }
+  else {
+    buckets[node.bucket] = node.next;
+  }
+  if (node.next != -1) nodes[node.next].prev = node.prev;
+  node.bucket = -1;
+}
+
+// Returns the index of the earliest node, or -1 if the queue is empty.
+// Walks the buckets day by day starting at currentDay. If no event is found
+//   within a whole year, falls back to a direct search of the bucket heads.
+int CalendarEventQueue::findMin() {
+  if (size == 0) return -1;
+
+  int numBuckets = buckets.size();
+  long long day = currentDay;
+  for (int i = 0; i < numBuckets; i++, day++) {
+    int head = buckets[day % numBuckets];
+    if (head != -1 && dayOf(nodes[head].event.time) <= day) {
+      currentDay = day;
+      return head;
+    }
+  }
+
+  int minNode = -1;
+  for (int b = 0; b < numBuckets; b++) {
+    if (buckets[b] != -1 && (minNode == -1 || before(buckets[b], minNode))) {
+      minNode = buckets[b];
+    }
+  }
+  currentDay = dayOf(nodes[minNode].event.time);
+  return minNode;
+}
+
+// Rebuilds the calendar with numBuckets buckets. The bucket width is set to
+//   three times the average spacing of the earliest pending events, ignoring
+//   gaps more than twice the average.
+void CalendarEventQueue::resize(int numBuckets) {
+  vector<int> pending;
+  vector<SimTime> times;
+  for (int n = 0; n < (int)nodes.size(); n++) {
+    if (nodes[n].bucket != -1) {
+      pending.push_back(n);
+      times.push_back(nodes[n].event.time);
+    }
+  }
+
+  if (times.size() >= 2) {
+    int k = min((int)times.size(), WIDTH_SAMPLE_SIZE);
+    partial_sort(times.begin(), times.begin() + k, times.end());
+    double avgGap = toSeconds(times[k - 1] - times[0]) / (k - 1);
+    double sum = 0.0;
+    int count = 0;
+    for (int i = 1; i < k; i++) {
+      double gap = toSeconds(times[i] - times[i - 1]);
+      if (gap <= 2 * avgGap) {
+        sum += gap;
+        count++;
+      }
+    }
+    if (sum > 0) width = 3 * sum / count;
+  }
+
+  buckets.assign(numBuckets, -1);
+  for (int n : pending) {
+    link(n);
+  }
+  if (!times.empty()) {
+    currentDay = dayOf(*min_element(times.begin(), times.end()));
+  }
+}
+
+EventHandle CalendarEventQueue::push(EventType type, SimTime t, ProcessIndex process) {
+  int n;
+  if (!freeNodes.empty()) {
+    n = freeNodes.back();
+    freeNodes.pop_back();
+  }
+  else {
+    n = nodes.size();
+    nodes.push_back(Node());
+  }
+  nodes[n].event.type = type;
+  nodes[n].event.time = t;
+  nodes[n].event.process = process;
+  nodes[n].seq = nextSeq++;
+
+  link(n);
+  size++;
+  long long day = dayOf(t);
+  if (day < currentDay) currentDay = day;
+
+  if (size > 2 * (int)buckets.size()) resize(2 * buckets.size());
+  return n;
+}
+
+Event CalendarEventQueue::popMin() {
+  int n = findMin();
+  if (n == -1) {
+    throw runtime_error("Error: Event queue is empty.");
+  }
+  Event e = nodes[n].event;
+  remove(n);
+  return e;
+}
+
+Event CalendarEventQueue::peek() {
+  int n = findMin();
+  if (n == -1) {
+    throw runtime_error("Error: Event queue is empty.");
+  }
+  return nodes[n].event;
+}
+
+// Deletes the event with the given handle.
+// Returns true if event was found and deleted, false otherwise.
+bool CalendarEventQueue::remove(EventHandle handle) {
+  if (handle < 0 || handle >= (EventHandle)nodes.size() || nodes[handle].bucket == -1) {
+    return false;
+  }
+  unlink(handle);
+  freeNodes.push_back(handle);
+  size--;
+
+  int numBuckets = buckets.size();
+  if (numBuckets > MIN_BUCKETS && size < numBuckets / 2) resize(numBuckets / 2);
+  return true;
+}
+
+bool CalendarEventQueue::isEmpty() {
+  return size == 0;
+}
+
+int CalendarEventQueue::getSize() {
+  return size;
+}
+
+// Nodes are only added when none are free, so their count is the peak size.
+int CalendarEventQueue::getPeakSize() {
+  return nodes.size();
+}
@@ -0,0 +1,58 @@
+#ifndef CALENDAREVENTQUEUE_H
+#define CALENDAREVENTQUEUE_H
+
+#include "EventQueue.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Event queue stored as a calendar queue (R. Brown, 1988).
+// Time is split into "days" of equal width that map onto a ring of
+//   buckets ("a year"); each bucket keeps a short sorted list.
+//   Amortized O(1) push, pop and remove when the bucket width matches
+//   the spacing of pending events. The number of buckets doubles or
+//   halves with the queue size, and the width is re-estimated from the
+//   earliest pending events on every resize.
+class CalendarEventQueue : public EventQueue {
+  private:
+    static const int MIN_BUCKETS = 2;
+    static const int WIDTH_SAMPLE_SIZE = 25;
+
+    struct Node {
+      Event event;
+      long long seq;    // Insertion order, breaks ties between equal times (newest first)
+      int prev;
+      int next;
+      int bucket;       // Bucket the node is linked into, -1 if free
+    };
+
+    vector<Node> nodes;
+    vector<int> freeNodes;
+    vector<int> buckets;      // Index of the earliest node in each bucket, -1 if empty
+    double width;             // Length of time covered by one bucket
+    long long currentDay;     // Day that the last search for the minimum stopped at
+    int size;
+    long long nextSeq;
+
+    bool before(int, int);
+    long long dayOf(SimTime);
+    void link(int);
+    void unlink(int);
+    int findMin();
+    void resize(int);
+
+  public:
+    CalendarEventQueue();
+
+    EventHandle push(EventType, SimTime, ProcessIndex);
+    Event popMin();
+    Event peek();
+    bool remove(EventHandle);
+
+    bool isEmpty();
+    int getSize();
+    int getPeakSize();
+};
+
+#endif // CALENDAREVENTQUEUE_H
@@ -0,0 +1,24 @@
+#ifndef EVENT_H
+#define EVENT_H
+
+#include "EventHandle.h"
+#include "../processes/ProcessIndex.h"
+#include "../SimTime.h"
+
+// ====================================================================
+// Event structures
+enum EventType {
+  ARRIVAL,
+  DEPARTURE,
+  PREEMPTION,
+  QUANTUM_EXPIRY,
+  PUSH_MIGRATION
+};
+
+struct Event {
+  SimTime time;
+  EventType type;
+  ProcessIndex process;
+};
+
+#endif // EVENT_H
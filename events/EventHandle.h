@@ -0,0 +1,9 @@
+#ifndef EVENTHANDLE_H
+#define EVENTHANDLE_H
+
+// Opaque handle returned when an event is scheduled.
+// Only valid until the event is popped or removed.
+typedef long long EventHandle;
+const EventHandle NO_EVENT = -1;
+
+#endif // EVENTHANDLE_H
@@ -0,0 +1,27 @@
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include "Event.h"
+
+// ====================================================================
+// Interface for the pending event set of the simulation.
+// Events are ordered by ascending time. Events with equal times are
+//   ordered newest first, so an event scheduled for the current time (e.g.
+//   an SRTF preemption) runs before anything else pending at that time.
+//   All implementations follow this rule, so runs are reproducible
+//   regardless of the implementation used.
+class EventQueue {
+  public:
+    virtual EventHandle push(EventType type, SimTime time, ProcessIndex process) = 0;
+    virtual Event popMin() = 0;
+    virtual Event peek() = 0;
+    virtual bool remove(EventHandle handle) = 0;
+
+    virtual bool isEmpty() = 0;
+    virtual int getSize() = 0;
+    virtual int getPeakSize() = 0;    // Most events ever pending at once
+
+    virtual ~EventQueue() = default;
+};
+
+#endif // EVENTQUEUE_H
@@ -0,0 +1,11 @@
+#ifndef EVENTQUEUETYPE_H
+#define EVENTQUEUETYPE_H
+
+enum EventQueueType {
+  LIST_QUEUE,
+  HEAP_QUEUE,
+  CALENDAR_QUEUE,
+  AUTO_QUEUE,         // LIST_QUEUE up to AUTO_QUEUE_LIST_MAX_CPUS CPUs, HEAP_QUEUE above
+};
+
+#endif // EVENTQUEUETYPE_H
@@ -0,0 +1,148 @@
+#include "HeapEventQueue.h"
+#include <stdexcept>
+
+HeapEventQueue::HeapEventQueue() {
+  freeHead = -1;
+  nextSeq = 0;
+}
+
+// Orders entries by ascending time, then newest first. Sequence numbers are
+//   compared by their wrapped difference, which stays correct as long as
+//   no event is pending while 2^31 others are pushed.
+inline bool HeapEventQueue::before(const HeapEntry &a, const HeapEntry &b) {
+  return a.time < b.time || (a.time == b.time && int32_t(a.seq - b.seq) > 0);
+}
+
+// Moves entry up from the hole at pos to its place.
+void HeapEventQueue::siftUp(int pos, HeapEntry entry) {
+  while (pos > 0) {
+    int parent = (pos - 1) / ARITY;
+    if (!before(entry, heap[parent])) break;
+    heap[pos] = heap[parent];
+    heapPos[heap[pos].slot] = pos;
+    pos = parent;
+  }
+  heap[pos] = entry;
+  heapPos[entry.slot] = pos;
+}
+
+// Moves entry down from the hole at pos to its place.
+void HeapEventQueue::siftDown(int pos, HeapEntry entry) {
+  int n = heap.size();
+  while (true) {
+    int first = pos * ARITY + 1;
+    if (first >= n) break;
+    int last = first + ARITY < n ? first + ARITY : n;
+    int minChild = first;
+    for (int c = first + 1; c < last; c++) {
+      if (before(heap[c], heap[minChild])) minChild = c;
+    }
+    if (!before(heap[minChild], entry)) break;
+    heap[pos] = heap[minChild];
+    heapPos[heap[pos].slot] = pos;
+    pos = minChild;
+  }
+  heap[pos] = entry;
+  heapPos[entry.slot] = pos;
+}
+
+void HeapEventQueue::freeSlot(int slot) {
+  heapPos[slot] = -2 - freeHead;
+  freeHead = slot;
+}
+
+EventHandle HeapEventQueue::push(EventType type, SimTime t, ProcessIndex process) {
+  int slot = freeHead;
+  if (slot >= 0) {
+    freeHead = -2 - heapPos[slot];
+  }
+  else {
+    slot = events.size();
+    events.push_back(Event());
+    heapPos.push_back(-1);
+  }
+  events[slot] = {t, type, process};
+
+  heap.push_back(HeapEntry());
+  siftUp(heap.size() - 1, {t, nextSeq++, slot});
+  return slot;
+}
+
+// Moves the hole at the root down along the smaller children to a leaf, then
+//   fills it with the last entry sifted up from there. The last entry nearly
+//   always belongs near the bottom, so this saves comparing it against every
+//   level's smallest child on the way down.
+Event HeapEventQueue::popMin() {
+  if (heap.empty()) {
+    throw runtime_error("Error: Event queue is empty.");
+  }
+  int slot = heap[0].slot;
+  HeapEntry last = heap.back();
+  heap.pop_back();
+  int n = heap.size();
+  if (n > 0) {
+    int pos = 0;
+    while (true) {
+      int first = pos * ARITY + 1;
+      if (first >= n) break;
+      int minChild = first;
+      if (first + ARITY <= n) {
+        int a = before(heap[first + 1], heap[first]) ? first + 1 : first;
+        int b = before(heap[first + 3], heap[first + 2]) ? first + 3 : first + 2;
+        minChild = before(heap[b], heap[a]) ? b : a;
+      }
+      else {
+        for (int c = first + 1; c < n; c++) {
+          if (before(heap[c], heap[minChild])) minChild = c;
+        }
+      }
+      heap[pos] = heap[minChild];
+      heapPos[heap[pos].slot] = pos;
+      pos = minChild;
+    }
+    siftUp(pos, last);
+  }
+  freeSlot(slot);
+  return events[slot];
+}
+
+Event HeapEventQueue::peek() {
+  if (heap.empty()) {
+    throw runtime_error("Error: Event queue is empty.");
+  }
+  return events[heap[0].slot];
+}
+
+// Deletes the event with the given handle.
+// Returns true if event was found and deleted, false otherwise.
+bool HeapEventQueue::remove(EventHandle handle) {
+  if (handle < 0 || handle >= (EventHandle)events.size() || heapPos[handle] < 0) {
+    return false;
+  }
+  int pos = heapPos[handle];
+  HeapEntry last = heap.back();
+  heap.pop_back();
+  if (pos < (int)heap.size()) {
+    if (pos > 0 && before(last, heap[(pos - 1) / ARITY])) {
+      siftUp(pos, last);
+    }
+    else {
+      siftDown(pos, last);
+    }
+  }
+  freeSlot(handle);
+  return true;
+}
+
+bool HeapEventQueue::isEmpty() {
+  return heap.empty();
+}
+
+int HeapEventQueue::getSize() {
+  return heap.size();
+}
+
+// Slots are only added when none are free, so their count is the peak size.
+int HeapEventQueue::getPeakSize() {
+  return events.size();
+}
@@ -0,0 +1,50 @@
+#ifndef HEAPEVENTQUEUE_H
+#define HEAPEVENTQUEUE_H
+
+#include "EventQueue.h"
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Event queue stored as an array-backed, indexed 4-ary min-heap.
+// O(log n) push, pop and remove. Event payloads live in a slot array that
+//   is reused through a free list threaded through the slots' heap
+//   positions, and the heap itself only holds 16-byte (time, sequence,
+//   slot) entries so that sift operations stay in cache.
+class HeapEventQueue : public EventQueue {
+  private:
+    static const int ARITY = 4;
+
+    struct HeapEntry {
+      SimTime time;
+      uint32_t seq;     // Insertion order, breaks ties between equal times (newest first)
+      int slot;
+    };
+
+    vector<HeapEntry> heap;
+    vector<Event> events;     // Payload of each slot
+    vector<int> heapPos;      // Position of each slot in the heap, or -2 - next free slot if free
+    int freeHead;             // First free slot, -1 if none
+    uint32_t nextSeq;
+
+    static bool before(const HeapEntry &, const HeapEntry &);
+    void siftUp(int, HeapEntry);
+    void siftDown(int, HeapEntry);
+    void freeSlot(int);
+
+  public:
+    HeapEventQueue();
+
+    EventHandle push(EventType, SimTime, ProcessIndex);
+    Event popMin();
+    Event peek();
+    bool remove(EventHandle);
+
+    bool isEmpty();
+    int getSize();
+    int getPeakSize();
+};
+
+#endif // HEAPEVENTQUEUE_H
@@ -0,0 +1,100 @@
+#include "ListEventQueue.h"
+#include <stdexcept>
+
+using namespace std;
+
+struct ListEventQueue::Node {
+  Event event;
+  EventHandle handle;
+  Node *next;
+};
+
+ListEventQueue::ListEventQueue() {
+  nodePool = new ObjectPool<Node>();
+  head = nullptr;
+  size = 0;
+  nextHandle = 0;
+}
+
+ListEventQueue::~ListEventQueue() {
+  delete nodePool;
+}
+
+// Inserts new event sorted by accending times, before any events with the same time.
+EventHandle ListEventQueue::push(EventType type, SimTime t, ProcessIndex process) {
+  Node *node = nodePool->create();
+  node->event.type = type;
+  node->event.time = t;
+  node->event.process = process;
+  node->handle = nextHandle++;
+  node->next = nullptr;
+
+  if (!head || t <= head->event.time) {
+    node->next = head;
+    head = node;
+  }
+  else {
+    Node *p = head;
+    while (p->next && p->next->event.time < t) {
+      p = p->next;
+    }
+    node->next = p->next;
+    p->next = node;
+  }
+  size++;
+  return node->handle;
+}
+
+Event ListEventQueue::popMin() {
+  if (!head) {
+    throw runtime_error("Error: Event queue is empty.");
+  }
+  Node *node = head;
+  Event e = node->event;
+  head = head->next;
+  size--;
+  nodePool->destroy(node);
+  return e;
+}
+
+Event ListEventQueue::peek() {
+  if (!head) {
+    throw runtime_error("Error: Event queue is empty.");
+  }
+  return head->event;
+}
+
+// Deletes the event with the given handle.
+// Returns true if event was found and deleted, false otherwise.
+bool ListEventQueue::remove(EventHandle handle) {
+  Node *prev = nullptr;
+  Node *current = head;
+  while (current) {
+    if (current->handle == handle) {
+      if (prev) {
+        prev->next = current->next;
+      }
+      else {
+        head = current->next;
+      }
+      nodePool->destroy(current);
+      size--;
+      return true;
+    }
+    prev = current;
+    current = current->next;
+  }
+  return false;
+}
+
+bool ListEventQueue::isEmpty() {
+  return head == nullptr;
+}
+
+int ListEventQueue::getSize() {
+  return size;
+}
+
+int ListEventQueue::getPeakSize() {
+  return nodePool->getHighWaterMark();
+}
@@ -0,0 +1,35 @@
+#ifndef LISTEVENTQUEUE_H
+#define LISTEVENTQUEUE_H
+
+#include "EventQueue.h"
+#include "../pools/ObjectPool.h"
+
+// ====================================================================
+// Event queue stored as a linked list sorted by ascending times.
+// O(n) push and remove (a scan for the handle), O(1) pop. Only about
+//   numCPUs + 2 events are ever pending, so with few CPUs the scans are
+//   short and beat the heap's sifting (see events/eventQueueBenchmark). This
+//   is what AUTO_QUEUE, the default, uses up to AUTO_QUEUE_LIST_MAX_CPUS.
+class ListEventQueue : public EventQueue {
+  private:
+    struct Node;
+    ObjectPool<Node> *nodePool;
+    Node *head;
+    int size;
+    EventHandle nextHandle;
+
+  public:
+    ListEventQueue();
+    ~ListEventQueue();
+
+    EventHandle push(EventType, SimTime, ProcessIndex);
+    Event popMin();
+    Event peek();
+    bool remove(EventHandle);
+
+    bool isEmpty();
+    int getSize();
+    int getPeakSize();
+};
+
+#endif // LISTEVENTQUEUE_H
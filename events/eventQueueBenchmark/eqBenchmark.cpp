@@ -0,0 +1,87 @@
+#include "../../events/EventQueue.h"
+#include "../../events/ListEventQueue.h"
+#include "../../events/HeapEventQueue.h"
+#include "../../events/CalendarEventQueue.h"
+#include "../../events/EventQueueType.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace std;
+
+// Runs a "hold" model shaped like the simulator's event set: one pending
+//   arrival plus one pending departure per CPU. Each operation pops the
+//   earliest event and schedules the next one of the same type, with
+//   exponential inter-arrival times (rate numCPUs) and service times (mean 1).
+// Returns events per second and writes a checksum of the pop order.
+double runHold(EventQueue *q, int numCPUs, int numOps, unsigned long long &checksum) {
+  mt19937 rng(12345);
+  exponential_distribution<double> interArrival(numCPUs);
+  exponential_distribution<double> service(1.0);
+
+  q->push(ARRIVAL, fromSeconds(interArrival(rng)), NO_PROCESS);
+  for (int i = 0; i < numCPUs; i++) {
+    q->push(DEPARTURE, fromSeconds(service(rng)), NO_PROCESS);
+  }
+
+  checksum = 0;
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < numOps; i++) {
+    Event e = q->popMin();
+    checksum = checksum * 31 + (unsigned long long)(toSeconds(e.time) * 1000000) + e.type;
+    double dt = e.type == ARRIVAL ? interArrival(rng) : service(rng);
+    q->push(e.type, e.time + fromSeconds(dt), NO_PROCESS);
+  }
+  auto end = chrono::steady_clock::now();
+
+  while (!q->isEmpty()) q->popMin();
+
+  double seconds = chrono::duration<double>(end - start).count();
+  return numOps / seconds;
+}
+
+EventQueue *createQueue(int type) {
+  switch (type) {
+    case LIST_QUEUE: return new ListEventQueue();
+    case HEAP_QUEUE: return new HeapEventQueue();
+    default: return new CalendarEventQueue();
+  }
+}
+
+int main() {
+  const int numOps = 2000000;
+  const string names[] = {"list", "heap", "calendar"};
+
+  cout << setw(8) << "CPUs";
+  for (string name : names) cout << setw(16) << name + " ev/s";
+  cout << endl;
+
+  for (int numCPUs = 1; numCPUs <= 4096; numCPUs *= 2) {
+    int listOps = min(numOps, max(20000, 200000000 / numCPUs));  // The list is too slow for full runs at large sizes
+    unsigned long long listSum = 0;
+
+    cout << setw(8) << numCPUs << fixed << setprecision(0);
+    for (int type = LIST_QUEUE; type <= CALENDAR_QUEUE; type++) {
+      unsigned long long sum;
+      EventQueue *q = createQueue(type);
+      double rate = runHold(q, numCPUs, listOps, sum);
+      if (type == LIST_QUEUE) {
+        listSum = sum;
+      }
+      else {
+        if (sum != listSum) {
+          cout << endl << "Error: " << names[type] << " and list popped events in a different order." << endl;
+          return 1;
+        }
+        rate = runHold(q, numCPUs, numOps, sum);
+      }
+      delete q;
+      cout << setw(16) << rate;
+    }
+    cout << endl;
+  }
+
+  return 0;
+}
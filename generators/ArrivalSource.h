@@ -0,0 +1,19 @@
+#ifndef ARRIVALSOURCE_H
+#define ARRIVALSOURCE_H
+
+#include "../SimTime.h"
+#include <cstdint>
+
+// ====================================================================
+// Interface for where processes come from: random draws or a recorded trace.
+// Arrivals are pulled one at a time as the simulation needs them.
+class ArrivalSource {
+  public:
+    // Gives the absolute arrival time, service time and workload class of
+    //   the next process. Returns false once there are no more arrivals.
+    virtual bool next(SimTime &arrivalTime, SimTime &serviceTime, uint32_t &processClass) = 0;
+
+    virtual ~ArrivalSource() = default;
+};
+
+#endif // ARRIVALSOURCE_H
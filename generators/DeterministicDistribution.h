@@ -0,0 +1,22 @@
+#ifndef DETERMINISTICDISTRIBUTION_H
+#define DETERMINISTICDISTRIBUTION_H
+
+#include "Distribution.h"
+
+// ====================================================================
+// Always returns the mean.
+class DeterministicDistribution : public Distribution {
+  private:
+    double mean;
+
+  public:
+    DeterministicDistribution(double mean) {
+      this->mean = mean;
+    }
+
+    double sample(Xoshiro256 &) {
+      return mean;
+    }
+};
+
+#endif // DETERMINISTICDISTRIBUTION_H
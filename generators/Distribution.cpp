@@ -0,0 +1,128 @@
+#include "Distribution.h"
+#include "ExponentialDistribution.h"
+#include "HyperexponentialDistribution.h"
+#include "GammaDistribution.h"
+#include "LognormalDistribution.h"
+#include "ParetoDistribution.h"
+#include "DeterministicDistribution.h"
+#include "EmpiricalDistribution.h"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+void Distribution::fill(Xoshiro256 &stream, double *values, int count) {
+  for (int i = 0; i < count; i++) {
+    values[i] = sample(stream);
+  }
+}
+
+// Standard normal, using Marsaglia's polar method
+double Distribution::sampleNormal(Xoshiro256 &stream) {
+  double x, y, r;
+  do {
+    x = 2 * stream.nextOpenUniform() - 1;
+    y = 2 * stream.nextOpenUniform() - 1;
+    r = x*x + y*y;
+  } while (r >= 1 || r == 0);
+  return x * sqrt(-2 * log(r) / r);
+}
+
+// Parses a number parameter, which must be in [min, infinity)
+static double parameter(const vector<string> &parts, int index, double min) {
+  double value;
+  try {
+    value = stod(parts.at(index));
+  }
+  catch (const logic_error &) {
+    throw runtime_error("Missing or invalid parameter " + to_string(index) + " for distribution " + parts[0] + ".");
+  }
+  if (!(value >= min) || isinf(value)) {
+    throw runtime_error("Parameter " + to_string(index) + " for distribution " + parts[0] + " is out of range.");
+  }
+  return value;
+}
+
+bool Distribution::isName(const string &name) {
+  static const char *NAMES[] = {"exp", "hyperexp", "erlang", "gamma", "lognormal", "pareto", "det", "empirical"};
+  for (const char *n : NAMES) {
+    if (name == n) return true;
+  }
+  return false;
+}
+
+Distribution *Distribution::create(const string &spec, double mean) {
+  if (!(mean > 0) || isinf(mean)) {
+    throw runtime_error("Distribution mean must be positive and finite.");
+  }
+
+  vector<string> parts;
+  stringstream specStream(spec);
+  string part;
+  while (getline(specStream, part, ':')) {
+    parts.push_back(part);
+  }
+  if (parts.empty()) {
+    throw runtime_error("Empty distribution spec.");
+  }
+
+  const string &name = parts[0];
+  int numParameters = 0;
+  Distribution *distribution;
+
+  if (name == "exp") {
+    distribution = new ExponentialDistribution(mean);
+  }
+  else if (name == "hyperexp") {
+    distribution = new HyperexponentialDistribution(mean, parameter(parts, 1, 1));
+    numParameters = 1;
+  }
+  else if (name == "erlang") {
+    double k = parameter(parts, 1, 1);
+    if (k != floor(k)) {
+      throw runtime_error("Erlang distribution needs a whole number of phases.");
+    }
+    distribution = new GammaDistribution(mean, k);
+    numParameters = 1;
+  }
+  else if (name == "gamma") {
+    double shape = parameter(parts, 1, 0);
+    if (shape == 0) {
+      throw runtime_error("Gamma distribution needs a positive shape.");
+    }
+    distribution = new GammaDistribution(mean, shape);
+    numParameters = 1;
+  }
+  else if (name == "lognormal") {
+    distribution = new LognormalDistribution(mean, parameter(parts, 1, 0));
+    numParameters = 1;
+  }
+  else if (name == "pareto") {
+    double alpha = parameter(parts, 1, 0);
+    if (alpha == 0) {
+      throw runtime_error("Pareto distribution needs a positive alpha.");
+    }
+    distribution = new ParetoDistribution(mean, alpha, parameter(parts, 2, 1));
+    numParameters = 2;
+  }
+  else if (name == "det") {
+    distribution = new DeterministicDistribution(mean);
+  }
+  else if (name == "empirical") {
+    if (parts.size() < 2) {
+      throw runtime_error("Empirical distribution needs a file.");
+    }
+    // The file name may itself contain colons (e.g. C:\...)
+    distribution = new EmpiricalDistribution(mean, spec.substr(spec.find(':') + 1));
+    numParameters = parts.size() - 1;
+  }
+  else {
+    throw runtime_error("Unknown distribution " + name + ".");
+  }
+
+  if (parts.size() != numParameters + 1) {
+    delete distribution;
+    throw runtime_error("Wrong number of parameters for distribution " + name + ".");
+  }
+  return distribution;
+}
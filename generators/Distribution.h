@@ -0,0 +1,43 @@
+#ifndef DISTRIBUTION_H
+#define DISTRIBUTION_H
+
+#include "Xoshiro256.h"
+#include <string>
+
+using namespace std;
+
+// ====================================================================
+// Interface for a distribution of positive times (service times or
+//   inter-arrival times) with a given mean.
+// Distributions are chosen with spec strings, the name followed by any
+//   shape parameters separated by colons:
+//     exp                   Exponential
+//     hyperexp:cv2          2-phase hyperexponential with balanced means and
+//                             squared coefficient of variation cv2 >= 1
+//     erlang:k              Erlang with k phases
+//     gamma:shape           Gamma with the given shape
+//     lognormal:sigma       Lognormal with the given sigma of the underlying normal
+//     pareto:alpha:ratio    Pareto with index alpha, bounded to [L, ratio * L]
+//     det                   Always the mean
+//     empirical:file        Table of values (and optional weights) read from file
+class Distribution {
+  public:
+    virtual double sample(Xoshiro256 &stream) = 0;
+
+    // Draws count samples into values. Distributions with a faster batched
+    //   sampler override this.
+    virtual void fill(Xoshiro256 &stream, double *values, int count);
+
+    virtual ~Distribution() = default;
+
+    // Throws runtime_error if the spec is invalid or the mean is not positive
+    static Distribution *create(const string &spec, double mean);
+
+    // True if name is one of the distribution names above
+    static bool isName(const string &name);
+
+  protected:
+    static double sampleNormal(Xoshiro256 &stream);
+};
+
+#endif // DISTRIBUTION_H
@@ -0,0 +1,84 @@
+#include "EmpiricalDistribution.h"
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+EmpiricalDistribution::EmpiricalDistribution(double mean, const string &file) {
+  ifstream in(file);
+  if (!in) {
+    throw runtime_error("Could not open empirical distribution file " + file + ".");
+  }
+
+  vector<double> weights;
+  string line;
+  while (getline(in, line)) {
+    line = line.substr(0, line.find('#'));
+    for (char &ch : line) {
+      if (ch == ',') ch = ' ';
+    }
+    stringstream lineStream(line);
+    double value, weight = 1;
+    if (!(lineStream >> value)) continue;     // Blank line
+    lineStream >> weight;
+    if (!(value >= 0) || !(weight >= 0) || isinf(value) || isinf(weight)) {
+      throw runtime_error("Invalid entry in empirical distribution file " + file + ".");
+    }
+    values.push_back(value);
+    weights.push_back(weight);
+  }
+
+  double totalWeight = 0, weightedSum = 0;
+  for (int i = 0; i < values.size(); i++) {
+    totalWeight += weights[i];
+    weightedSum += weights[i] * values[i];
+  }
+  if (totalWeight == 0 || weightedSum == 0) {
+    throw runtime_error("Empirical distribution file " + file + " has no positive values.");
+  }
+
+  double scale = mean / (weightedSum / totalWeight);
+  for (double &value : values) {
+    value *= scale;
+  }
+  for (double &weight : weights) {
+    weight *= values.size() / totalWeight;
+  }
+  buildAliasTable(weights);
+}
+
+// Takes weights scaled to average 1. Pairs each column below 1 with one
+//   above 1 that tops it up, so every column holds exactly 1.
+void EmpiricalDistribution::buildAliasTable(vector<double> weights) {
+  int n = weights.size();
+  keepProbability.assign(n, 1);
+  alias.resize(n);
+  for (int i = 0; i < n; i++) {
+    alias[i] = i;
+  }
+
+  vector<int> small, large;
+  for (int i = 0; i < n; i++) {
+    (weights[i] < 1 ? small : large).push_back(i);
+  }
+  while (!small.empty() && !large.empty()) {
+    int s = small.back();
+    int l = large.back();
+    small.pop_back();
+    keepProbability[s] = weights[s];
+    alias[s] = l;
+    weights[l] -= 1 - weights[s];
+    if (weights[l] < 1) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // Anything left over is 1 up to rounding, so keeps itself
+}
+
+double EmpiricalDistribution::sample(Xoshiro256 &stream) {
+  uint64_t bits = stream.next();
+  int column = ((bits >> 32) * values.size()) >> 32;
+  double coin = (bits & 0xFFFFFFFF) * 0x1.0p-32;
+  return values[coin < keepProbability[column] ? column : alias[column]];
+}
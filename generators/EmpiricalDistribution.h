@@ -0,0 +1,30 @@
+#ifndef EMPIRICALDISTRIBUTION_H
+#define EMPIRICALDISTRIBUTION_H
+
+#include "Distribution.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Discrete distribution over a table of values read from a file, one
+//   "value" or "value, weight" per line (# starts a comment). Values are
+//   scaled so the distribution has the requested mean, so the file only
+//   needs to give the shape.
+// Sampled in O(1) with Walker's alias method (Vose's construction).
+class EmpiricalDistribution : public Distribution {
+  private:
+    vector<double> values;
+    vector<double> keepProbability;   // Chance of keeping column i rather than its alias
+    vector<int> alias;
+
+    void buildAliasTable(vector<double>);
+
+  public:
+    EmpiricalDistribution(double, const string &);
+
+    double sample(Xoshiro256 &);
+};
+
+#endif // EMPIRICALDISTRIBUTION_H
@@ -0,0 +1,73 @@
+#include "ExponentialDistribution.h"
+#include <cmath>
+#include <cstring>
+
+ExponentialDistribution::ExponentialDistribution(double mean) {
+  this->mean = mean;
+}
+
+double ExponentialDistribution::sample(Xoshiro256 &stream) {
+  return -log(stream.nextOpenUniform()) * mean;
+}
+
+void ExponentialDistribution::fill(Xoshiro256 &stream, double *values, int count) {
+  fillUnit(stream, values, count);
+  for (int i = 0; i < count; i++) {
+    values[i] *= mean;
+  }
+}
+
+// Computes -log(u) for the uniforms u in (0, 1] given by their bit patterns.
+// Same method as fdlibm's log: split u into 2^k * m with m in [sqrt(2)/2, sqrt(2)),
+//   then approximate log(m) with a polynomial in s = (m-1)/(m+1). It only uses
+//   integer adds, shifts and masks plus double arithmetic, with no branches or
+//   library calls, so the compiler vectorizes the loop even for plain SSE2.
+static void negativeLog(const uint64_t *uniformBits, double *values, int count) {
+  const double LN2_HI = 6.93147180369123816490e-01;
+  const double LN2_LO = 1.90821492927058770002e-10;
+  const double LG1 = 6.666666666666735130e-01;
+  const double LG2 = 3.999999999940941908e-01;
+  const double LG3 = 2.857142874366239149e-01;
+  const double LG4 = 2.222219843214978396e-01;
+  const double LG5 = 1.818357216161805012e-01;
+  const double LG6 = 1.531383769920937332e-01;
+  const double LG7 = 1.479819860511658591e-01;
+  const uint64_t MANTISSA_MASK = 0xFFFFFFFFFFFFFULL;
+  const double TWO_52 = 4503599627370496.0;
+
+  for (int i = 0; i < count; i++) {
+    uint64_t bits = uniformBits[i];
+
+    // high is 1 when the mantissa is at least sqrt(2), found by letting the add
+    //   carry into the exponent field instead of comparing
+    uint64_t high = ((bits & MANTISSA_MASK) + 0x95F6400000000ULL) >> 52;
+    uint64_t mBits = (bits & MANTISSA_MASK) | ((1023 - high) << 52);
+    uint64_t kBits = 0x4330000000000000ULL | ((bits >> 52) + high);   // 2^52 + biased k
+    double m, kPlus;
+    memcpy(&m, &mBits, sizeof(m));
+    memcpy(&kPlus, &kBits, sizeof(kPlus));
+    double k = kPlus - (TWO_52 + 1023);
+
+    double f = m - 1.0;
+    double s = f / (2.0 + f);
+    double z = s * s;
+    double w = z * z;
+    double R = z * (LG1 + w * (LG3 + w * (LG5 + w * LG7))) + w * (LG2 + w * (LG4 + w * LG6));
+    double hfsq = 0.5 * f * f;
+
+    values[i] = -(k * LN2_HI - ((hfsq - (s * (hfsq + R) + k * LN2_LO)) - f));
+  }
+}
+
+void ExponentialDistribution::fillUnit(Xoshiro256 &stream, double *values, int count) {
+  const int CHUNK = 256;
+  uint64_t uniformBits[CHUNK];
+  for (int start = 0; start < count; start += CHUNK) {
+    int n = count - start < CHUNK ? count - start : CHUNK;
+    for (int i = 0; i < n; i++) {
+      double u = stream.nextOpenUniform();
+      memcpy(&uniformBits[i], &u, sizeof(u));
+    }
+    negativeLog(uniformBits, values + start, n);
+  }
+}
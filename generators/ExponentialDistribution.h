@@ -0,0 +1,22 @@
+#ifndef EXPONENTIALDISTRIBUTION_H
+#define EXPONENTIALDISTRIBUTION_H
+
+#include "Distribution.h"
+
+// ====================================================================
+// Exponential distribution, sampled in blocks with a vectorized log.
+class ExponentialDistribution : public Distribution {
+  private:
+    double mean;
+
+  public:
+    ExponentialDistribution(double);
+
+    double sample(Xoshiro256 &);
+    void fill(Xoshiro256 &, double *, int);
+
+    // Draws count unit-mean exponentials into values
+    static void fillUnit(Xoshiro256 &, double *, int);
+};
+
+#endif // EXPONENTIALDISTRIBUTION_H
@@ -0,0 +1,58 @@
+#include "GammaDistribution.h"
+#include "ExponentialDistribution.h"
+#include <cmath>
+
+GammaDistribution::GammaDistribution(double mean, double shape) {
+  this->shape = shape;
+  scale = mean / shape;
+  isErlang = shape == floor(shape) && shape <= MAX_PHASES;
+
+  // Shapes below 1 are sampled as Gamma(shape + 1) * u^(1/shape)
+  d = (shape < 1 ? shape + 1 : shape) - 1.0 / 3;
+  c = 1 / sqrt(9 * d);
+}
+
+double GammaDistribution::sample(Xoshiro256 &stream) {
+  if (isErlang) {
+    double sum = 0;
+    for (int k = 0; k < shape; k++) {
+      sum -= log(stream.nextOpenUniform());
+    }
+    return sum * scale;
+  }
+
+  double x, v, u;
+  do {
+    do {
+      x = sampleNormal(stream);
+      v = 1 + c * x;
+    } while (v <= 0);
+    v = v * v * v;
+    u = stream.nextOpenUniform();
+  } while (log(u) >= 0.5 * x * x + d - d * v + d * log(v));
+
+  double g = d * v;
+  if (shape < 1) {
+    g *= pow(stream.nextOpenUniform(), 1 / shape);
+  }
+  return g * scale;
+}
+
+void GammaDistribution::fill(Xoshiro256 &stream, double *values, int count) {
+  if (!isErlang) {
+    Distribution::fill(stream, values, count);
+    return;
+  }
+
+  phase.resize(count);
+  ExponentialDistribution::fillUnit(stream, values, count);
+  for (int k = 1; k < shape; k++) {
+    ExponentialDistribution::fillUnit(stream, phase.data(), count);
+    for (int i = 0; i < count; i++) {
+      values[i] += phase[i];
+    }
+  }
+  for (int i = 0; i < count; i++) {
+    values[i] *= scale;
+  }
+}
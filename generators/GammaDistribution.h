@@ -0,0 +1,30 @@
+#ifndef GAMMADISTRIBUTION_H
+#define GAMMADISTRIBUTION_H
+
+#include "Distribution.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Gamma distribution with the given shape (Erlang for whole shapes).
+// Whole shapes up to MAX_PHASES are sampled as a sum of exponentials, which
+//   reuses the vectorized log. Other shapes use Marsaglia and Tsang's method.
+class GammaDistribution : public Distribution {
+  private:
+    static const int MAX_PHASES = 16;
+
+    double shape;
+    double scale;
+    bool isErlang;
+    double d, c;          // Marsaglia-Tsang constants
+    vector<double> phase; // Scratch space for fill
+
+  public:
+    GammaDistribution(double, double);
+
+    double sample(Xoshiro256 &);
+    void fill(Xoshiro256 &, double *, int);
+};
+
+#endif // GAMMADISTRIBUTION_H
@@ -0,0 +1,26 @@
+#include "GeneratedArrivalSource.h"
+
+GeneratedArrivalSource::GeneratedArrivalSource(const vector<TimeGenerator *> &timeGens) {
+  this->timeGens = timeGens;
+  nextArrivalTimes.assign(timeGens.size(), SimTime());
+}
+
+GeneratedArrivalSource::~GeneratedArrivalSource() {
+  for (TimeGenerator *timeGen : timeGens) {
+    delete timeGen;
+  }
+}
+
+// Ties go to the lowest class.
+bool GeneratedArrivalSource::next(SimTime &arrivalTime, SimTime &serviceTime, uint32_t &processClass) {
+  int c = 0;
+  for (int i = 1; i < timeGens.size(); i++) {
+    if (nextArrivalTimes[i] < nextArrivalTimes[c]) c = i;
+  }
+
+  arrivalTime = nextArrivalTimes[c];
+  serviceTime = fromSeconds(timeGens[c]->getServiceTime());
+  processClass = c;
+  nextArrivalTimes[c] += fromSeconds(timeGens[c]->getInterArrivalTime());
+  return true;
+}
@@ -0,0 +1,31 @@
+#ifndef GENERATEDARRIVALSOURCE_H
+#define GENERATEDARRIVALSOURCE_H
+
+#include "ArrivalSource.h"
+#include "TimeGenerator.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Endless arrivals with random inter-arrival and service times, merged
+//   from one independent stream per workload class. Each class's first
+//   process arrives at time 0.
+// The next arrival of every class is kept, and the earliest is found with
+//   a scan, which is cheap for the few classes a workload has.
+class GeneratedArrivalSource : public ArrivalSource {
+  private:
+    vector<TimeGenerator *> timeGens;     // Per class
+    vector<SimTime> nextArrivalTimes;
+
+  public:
+    GeneratedArrivalSource(const vector<TimeGenerator *> &);    // Takes ownership of the generators
+    ~GeneratedArrivalSource();
+
+    GeneratedArrivalSource(const GeneratedArrivalSource &) = delete;
+    GeneratedArrivalSource &operator=(const GeneratedArrivalSource &) = delete;
+
+    bool next(SimTime &, SimTime &, uint32_t &);
+};
+
+#endif // GENERATEDARRIVALSOURCE_H
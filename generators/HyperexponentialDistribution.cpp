@@ -0,0 +1,21 @@
+#include "HyperexponentialDistribution.h"
+#include "ExponentialDistribution.h"
+#include <cmath>
+
+HyperexponentialDistribution::HyperexponentialDistribution(double mean, double cv2) {
+  p = 0.5 * (1 + sqrt((cv2 - 1) / (cv2 + 1)));
+  mean1 = mean / (2 * p);
+  mean2 = mean / (2 * (1 - p));
+}
+
+double HyperexponentialDistribution::sample(Xoshiro256 &stream) {
+  double phaseMean = stream.nextOpenUniform() <= p ? mean1 : mean2;
+  return -log(stream.nextOpenUniform()) * phaseMean;
+}
+
+void HyperexponentialDistribution::fill(Xoshiro256 &stream, double *values, int count) {
+  ExponentialDistribution::fillUnit(stream, values, count);
+  for (int i = 0; i < count; i++) {
+    values[i] *= stream.nextOpenUniform() <= p ? mean1 : mean2;
+  }
+}
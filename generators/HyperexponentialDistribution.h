@@ -0,0 +1,23 @@
+#ifndef HYPEREXPONENTIALDISTRIBUTION_H
+#define HYPEREXPONENTIALDISTRIBUTION_H
+
+#include "Distribution.h"
+
+// ====================================================================
+// 2-phase hyperexponential distribution with balanced means: each phase
+//   contributes half of the mean. Fitted to a squared coefficient of
+//   variation cv2 >= 1 (cv2 = 1 is exponential).
+class HyperexponentialDistribution : public Distribution {
+  private:
+    double p;             // Probability of the first phase
+    double mean1;
+    double mean2;
+
+  public:
+    HyperexponentialDistribution(double, double);
+
+    double sample(Xoshiro256 &);
+    void fill(Xoshiro256 &, double *, int);
+};
+
+#endif // HYPEREXPONENTIALDISTRIBUTION_H
@@ -0,0 +1,11 @@
+#include "LognormalDistribution.h"
+#include <cmath>
+
+LognormalDistribution::LognormalDistribution(double mean, double sigma) {
+  this->sigma = sigma;
+  mu = log(mean) - sigma * sigma / 2;
+}
+
+double LognormalDistribution::sample(Xoshiro256 &stream) {
+  return exp(mu + sigma * sampleNormal(stream));
+}
@@ -0,0 +1,20 @@
+#ifndef LOGNORMALDISTRIBUTION_H
+#define LOGNORMALDISTRIBUTION_H
+
+#include "Distribution.h"
+
+// ====================================================================
+// Lognormal distribution: exp of a normal with standard deviation sigma,
+//   its mean chosen so the lognormal has the given mean.
+class LognormalDistribution : public Distribution {
+  private:
+    double mu;
+    double sigma;
+
+  public:
+    LognormalDistribution(double, double);
+
+    double sample(Xoshiro256 &);
+};
+
+#endif // LOGNORMALDISTRIBUTION_H
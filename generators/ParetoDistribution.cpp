@@ -0,0 +1,25 @@
+#include "ParetoDistribution.h"
+#include <cmath>
+#include <stdexcept>
+
+ParetoDistribution::ParetoDistribution(double mean, double alpha, double ratio) {
+  if (!(ratio > 1)) {
+    throw runtime_error("Pareto distribution needs an upper bound ratio above 1.");
+  }
+  this->alpha = alpha;
+  tailMass = 1 - pow(ratio, -alpha);
+
+  // Mean of the distribution on [1, ratio], then scaled to the requested mean
+  double unitMean;
+  if (alpha == 1) {
+    unitMean = log(ratio) / tailMass;
+  }
+  else {
+    unitMean = alpha / (alpha - 1) * (1 - pow(ratio, 1 - alpha)) / tailMass;
+  }
+  low = mean / unitMean;
+}
+
+double ParetoDistribution::sample(Xoshiro256 &stream) {
+  return low * pow(1 - stream.nextOpenUniform() * tailMass, -1 / alpha);
+}
@@ -0,0 +1,21 @@
+#ifndef PARETODISTRIBUTION_H
+#define PARETODISTRIBUTION_H
+
+#include "Distribution.h"
+
+// ====================================================================
+// Bounded Pareto distribution with index alpha on [L, H], H = ratio * L,
+//   with L chosen to give the mean. Sampled by inverting the CDF.
+class ParetoDistribution : public Distribution {
+  private:
+    double alpha;
+    double low;
+    double tailMass;      // 1 - (L/H)^alpha
+
+  public:
+    ParetoDistribution(double, double, double);
+
+    double sample(Xoshiro256 &);
+};
+
+#endif // PARETODISTRIBUTION_H
@@ -1,12 +1,8 @@
 #include "RandomGenerator.h"
-#include <cstdlib>
-#include <ctime>
 
-RandomGenerator::RandomGenerator() {
-  srand(time(0));
-}
+RandomGenerator::RandomGenerator(const Xoshiro256 &stream) : stream(stream) {}
 
 // Generate a uniformly-random int in the range [0, maxIndex)
 int RandomGenerator::getRandomIndex(int maxIndex) {
-  return (double(rand())) / (double(RAND_MAX + 1.0)) * maxIndex;
-}
\ No newline at end of file
+  return stream.nextBelow(maxIndex);
+}
@@ -1,14 +1,22 @@
 #ifndef RANDOMGENERATOR_H
 #define RANDOMGENERATOR_H
 
+#include "Xoshiro256.h"
+
+using namespace std;
+
 // ====================================================================
 // Structure to generate uniformly distributed random integers
+// Draws from its own stream, independent of the other generators.
 class RandomGenerator {
+  private:
+    Xoshiro256 stream;
+
   public:
-    RandomGenerator();
+    RandomGenerator(const Xoshiro256 &);
 
     // Generate a uniformly-random int in the range [0, maxIndex)
     int getRandomIndex(int);
 };
 
-#endif // RANDOMGENERATOR_H
\ No newline at end of file
+#endif // RANDOMGENERATOR_H
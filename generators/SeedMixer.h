@@ -0,0 +1,16 @@
+#ifndef SEEDMIXER_H
+#define SEEDMIXER_H
+
+// ====================================================================
+// Derives the seed of the index-th run from a base seed using the splitmix64
+//   finalizer, so neighbouring runs get unrelated seeds. Never returns 0,
+//   which means seed from the current time.
+inline unsigned long long mixSeed(unsigned long long seed, unsigned long long index) {
+  unsigned long long z = seed + (index + 1) * 0x9E3779B97F4A7C15ULL;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z = z ^ (z >> 31);
+  return z ? z : 1;
+}
+
+#endif // SEEDMIXER_H
@@ -1,43 +1,34 @@
 #include "TimeGenerator.h"
-#include <ctime>
 #include <cmath>
 #include <stdexcept>
 
 using namespace std;
 
-float TimeGenerator::arrivalLambda = 0.0;
-float TimeGenerator::serviceTimeAvg = 0.0;
-
-TimeGenerator::TimeGenerator(float aLamb, float sTimeAvg) {
-  TimeGenerator::arrivalLambda = aLamb;
-  TimeGenerator::serviceTimeAvg = sTimeAvg;
-
-  // Seed random number generator
-  srand(time(0));
-}
-
-float TimeGenerator::getInterArrivalTime() {
-  if (!TimeGenerator::arrivalLambda) {
-    throw runtime_error("Error: Average Arrival Rate not set.");
+// The rate and mean are checked once here (by Distribution::create), so
+//   generating times needs no checks.
+TimeGenerator::TimeGenerator(const string &arrivalSpec, float aLamb, const string &serviceSpec, float sTimeAvg,
+                             const Xoshiro256 &arrivalStream, const Xoshiro256 &serviceStream)
+  : arrivals(nullptr, arrivalStream), services(nullptr, serviceStream) {
+  if (!(aLamb > 0) || isinf(aLamb)) {
+    throw runtime_error("Error: Average Arrival Rate must be positive and finite.");
   }
-  float p = double(rand() + 1.0) / double(RAND_MAX + 1.0);
-  float x = -log(p) / TimeGenerator::arrivalLambda;
-
-  if (isinf(x)) throw runtime_error("Error: interarrival time is infinite.");
-  if (isnan(x)) throw runtime_error("Error: interarrival time is NaN.");
-
-  return x;
-}
-
-float TimeGenerator::getServiceTime() {
-  if (!TimeGenerator::serviceTimeAvg) {
-    throw runtime_error("Error: Average Service Time not set.");
+  double interArrivalMean = 1.0 / aLamb;
+  arrivals.distribution = Distribution::create(arrivalSpec, interArrivalMean);
+  try {
+    services.distribution = Distribution::create(serviceSpec, sTimeAvg);
+  }
+  catch (...) {
+    delete arrivals.distribution;
+    throw;
   }
-  float p = ((double)rand() + 1.0) / double(RAND_MAX + 1.0);
-  float x = -log(p) * TimeGenerator::serviceTimeAvg;
+}
 
-  if (isinf(x)) throw runtime_error("Error: service time is infinite.");
-  if (isnan(x)) throw runtime_error("Error: service time is NaN.");
+TimeGenerator::~TimeGenerator() {
+  delete arrivals.distribution;
+  delete services.distribution;
+}
 
-  return x;
+void TimeGenerator::VariateBuffer::refill() {
+  distribution->fill(stream, values, BLOCK_SIZE);
+  next = 0;
 }
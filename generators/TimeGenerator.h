@@ -1,20 +1,56 @@
 #ifndef TIMEGENERATOR_H
 #define TIMEGENERATOR_H
 
+#include "Distribution.h"
+#include "Xoshiro256.h"
+#include <string>
+
+using namespace std;
+
 // ====================================================================
-// Structure to generate exponentially distributed times
-// Used for service times and inter-arrival times
+// Structure to generate random service times and inter-arrival times
+// Each has its own distribution (see Distribution.h) and draws from its own
+//   stream, so changing how one is used does not shift the other.
+// Times are generated a block at a time into a buffer, so the per-call
+//   cost is a load.
 class TimeGenerator {
 
   private:
-    static float arrivalLambda;
-    static float serviceTimeAvg;
+    static const int BLOCK_SIZE = 256;
+
+    struct VariateBuffer {
+      Distribution *distribution;
+      Xoshiro256 stream;
+      double values[BLOCK_SIZE];
+      int next;
+
+      VariateBuffer(Distribution *distribution, const Xoshiro256 &stream)
+        : distribution(distribution), stream(stream), next(BLOCK_SIZE) {}
+      void refill();
+    };
+
+    VariateBuffer arrivals;
+    VariateBuffer services;
 
   public:
-    TimeGenerator(float, float);
+    // Takes the arrival distribution spec and rate, then the service time
+    //   distribution spec and mean, then the two streams
+    TimeGenerator(const string &, float, const string &, float, const Xoshiro256 &, const Xoshiro256 &);
+    ~TimeGenerator();
+
+    TimeGenerator(const TimeGenerator &) = delete;
+    TimeGenerator &operator=(const TimeGenerator &) = delete;
+
+    // Times are in seconds
+    double getInterArrivalTime() {
+      if (arrivals.next == BLOCK_SIZE) arrivals.refill();
+      return arrivals.values[arrivals.next++];
+    }
 
-    float getInterArrivalTime();
-    float getServiceTime();
+    double getServiceTime() {
+      if (services.next == BLOCK_SIZE) services.refill();
+      return services.values[services.next++];
+    }
 };
 
-#endif // TIMEGENERATOR_H
\ No newline at end of file
+#endif // TIMEGENERATOR_H
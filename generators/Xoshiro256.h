@@ -0,0 +1,97 @@
+#ifndef XOSHIRO256_H
+#define XOSHIRO256_H
+
+#include <cstdint>
+
+using namespace std;
+
+// ====================================================================
+// xoshiro256++ pseudo-random number generator (Blackman and Vigna).
+// 256 bits of state, period 2^256 - 1, and a few shifts and adds per number.
+// jump() advances by 2^128 numbers and longJump() by 2^192, so copies of one
+//   generator can be split into non-overlapping streams.
+// Also usable as a standard UniformRandomBitGenerator.
+class Xoshiro256 {
+  private:
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k) {
+      return (x << k) | (x >> (64 - k));
+    }
+
+    void jumpBy(const uint64_t (&polynomial)[4]) {
+      uint64_t t[4] = {0, 0, 0, 0};
+      for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+          if (polynomial[i] & (uint64_t(1) << b)) {
+            for (int j = 0; j < 4; j++) t[j] ^= s[j];
+          }
+          next();
+        }
+      }
+      for (int j = 0; j < 4; j++) s[j] = t[j];
+    }
+
+  public:
+    typedef uint64_t result_type;
+
+    // Expands the seed into the full state with splitmix64, as recommended by
+    //   the authors, so similar seeds still give unrelated streams.
+    explicit Xoshiro256(uint64_t seed) {
+      for (int i = 0; i < 4; i++) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        s[i] = z ^ (z >> 31);
+      }
+    }
+
+    uint64_t next() {
+      uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+      uint64_t t = s[1] << 17;
+      s[2] ^= s[0];
+      s[3] ^= s[1];
+      s[1] ^= s[2];
+      s[0] ^= s[3];
+      s[2] ^= t;
+      s[3] = rotl(s[3], 45);
+      return result;
+    }
+
+    // Uniform in (0, 1], so its log is always finite
+    double nextOpenUniform() {
+      return ((next() >> 11) + 1) * 0x1.0p-53;
+    }
+
+    // Uniform in [0, bound), using the top 32 bits of a number (Lemire)
+    uint32_t nextBelow(uint32_t bound) {
+      return ((next() >> 32) * bound) >> 32;
+    }
+
+    void jump() {
+      static const uint64_t JUMP[4] = {
+        0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL
+      };
+      jumpBy(JUMP);
+    }
+
+    void longJump() {
+      static const uint64_t LONG_JUMP[4] = {
+        0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL
+      };
+      jumpBy(LONG_JUMP);
+    }
+
+    uint64_t operator()() {
+      return next();
+    }
+    static constexpr uint64_t min() {
+      return 0;
+    }
+    static constexpr uint64_t max() {
+      return UINT64_MAX;
+    }
+};
+
+#endif // XOSHIRO256_H
@@ -11,12 +11,14 @@ using namespace std;
 map<InputHandler::InputType, string> InputHandler::inputMessages = {
   {InputHandler::ARRIVAL_RATE, "Enter the average arrival rate (processes per second): "},
   {InputHandler::SERVICE_TIME, "Enter the average service time (seconds): "},
-  {InputHandler::SCHEDULER, "Pick the scheduler (0 for FCFS, 1 for SJF, 2 for SRTF, 3 for HRRN): "},
+  {InputHandler::SCHEDULER, "Pick the scheduler (0 for FCFS, 1 for SJF, 2 for SRTF, 3 for HRRN, 4 for RR, 5 for MLFQ, 6 for Priority): "},
   {InputHandler::RQ_SETUP, "Pick the Ready Queue setup (1 for RQ per-CPU, 2 for single global RQ): "},
   {InputHandler::NUM_CPUS, "Enter the number of CPUs: "},
   {InputHandler::END_CONDITION, "Pick the end condition (0 for processes arrived, 1 for processes departed, 2 for time limit): "},
   {InputHandler::N, "Enter the number of processes: "},
-  {InputHandler::TIME_LIMIT, "Enter the time limit (seconds): "}
+  {InputHandler::TIME_LIMIT, "Enter the time limit (seconds): "},
+  {InputHandler::EVENT_QUEUE, "Pick the event queue (0 for sorted list, 1 for 4-ary heap, 2 for calendar queue, 3 for list or heap by CPU count): "},
+  {InputHandler::QUANTUM, "Enter the time quantum (seconds): "}
 };
 
 map<InputHandler::InputType, bool> InputHandler::inputChoices = {
@@ -27,13 +29,16 @@ map<InputHandler::InputType, bool> InputHandler::inputChoices = {
   {InputHandler::NUM_CPUS, CHOOSE_NUM_CPUS},
   {InputHandler::END_CONDITION, CHOOSE_END_CONDITION},
   {InputHandler::N, CHOOSE_END_CONDITION},
-  {InputHandler::TIME_LIMIT, CHOOSE_END_CONDITION}
+  {InputHandler::TIME_LIMIT, CHOOSE_END_CONDITION},
+  {InputHandler::EVENT_QUEUE, CHOOSE_EVENT_QUEUE},
+  {InputHandler::QUANTUM, CHOOSE_SCHEDULER}
 };
 
 map<InputHandler::InputType, float> InputHandler::floatDefaults = {
   {InputHandler::ARRIVAL_RATE, 1.0},
   {InputHandler::SERVICE_TIME, 1.0},
-  {InputHandler::TIME_LIMIT, DEFAULT_TIME_LIMIT}
+  {InputHandler::TIME_LIMIT, DEFAULT_TIME_LIMIT},
+  {InputHandler::QUANTUM, DEFAULT_RR_QUANTUM}
 };
 
 map<InputHandler::InputType, int> InputHandler::intDefaults = {
@@ -41,7 +46,8 @@ map<InputHandler::InputType, int> InputHandler::intDefaults = {
   {InputHandler::RQ_SETUP, DEFAULT_RQ_SETUP},
   {InputHandler::NUM_CPUS, DEFAULT_NUM_CPUS},
   {InputHandler::END_CONDITION, static_cast<int>(DEFAULT_END_CONDITION)},
-  {InputHandler::N, DEFAULT_N}
+  {InputHandler::N, DEFAULT_N},
+  {InputHandler::EVENT_QUEUE, static_cast<int>(DEFAULT_EVENT_QUEUE)}
 };
 
 template <typename Type>
@@ -103,7 +109,7 @@ Type InputHandler::performInputLoop(InputType inputType) {
         }
         break;
       case SCHEDULER:
-        if (0 <= input && input <= 3) {
+        if (0 <= input && input <= 6) {
           validInput = true;
         }
         break;
@@ -132,6 +138,16 @@ Type InputHandler::performInputLoop(InputType inputType) {
           validInput = true;
         }
         break;
+      case EVENT_QUEUE:
+        if (0 <= input && input <= 3) {
+          validInput = true;
+        }
+        break;
+      case QUANTUM:
+        if (input > 0) {
+          validInput = true;
+        }
+        break;
       default:
         throw runtime_error("Invalid input type.");
     }
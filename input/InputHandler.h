@@ -18,7 +18,9 @@ class InputHandler {
       NUM_CPUS,
       END_CONDITION,
       N,
-      TIME_LIMIT
+      TIME_LIMIT,
+      EVENT_QUEUE,
+      QUANTUM
     };
 
     template <typename Type>
@@ -1,7 +1,7 @@
 #ifndef OUTPUT_H
 #define OUTPUT_H
 
-#include "../processes/Process.h"
+#include "../processes/ProcessTable.h"
 #include "../processes/ReadyQueueList.h"
 #include <vector>
 #include <string>
@@ -15,21 +15,44 @@ class Output {
       TOTAL_THROUGHPUT,
       CPU_UTILIZATION,
       AVG_PROCESSES_IN_Q,
+      PEAK_PROCESSES,
+      PEAK_EVENTS,
+      RQ_LENGTH_DISTRIBUTION,
+      REPLICATIONS,
+      MIGRATIONS_IN,
+      MIGRATIONS_OUT,
+      CLASS_AVG_TURN_TIME,
+      CLASS_THROUGHPUT,
+      CLASS_UTILIZATION,
+      PROCESS_CLASS_AVG_TURN_TIME,
+      PROCESS_CLASS_AVG_WAIT_TIME,
+      PROCESS_CLASS_AVG_SLOWDOWN,
+      PROCESS_CLASS_THROUGHPUT,
+      TURN_TIME_PERCENTILES,
+      WAIT_TIME_PERCENTILES,
+      RESPONSE_TIME_PERCENTILES,
     };
 
     enum LiveUpdateType {
       ARRIVAL_TO_CPU,
       ARRIVAL_PREEMPT_SRTF,
+      ARRIVAL_PREEMPT_PRIORITY,
       ARRIVAL_TO_RQ,
       DEPARTURE_CPU_IDLE,
       DEPARTURE_NEXT_PROCESS,
-      PREEMPTION_INTERVAL
+      DEPARTURE_PULL_MIGRATION,
+      PREEMPTION_INTERVAL,
+      PUSH_MIGRATION_TO_CPU,
+      PUSH_MIGRATION_TO_RQ
     };
 
     virtual void printTitle() = 0;
     virtual void printHeader(string message) = 0;
     virtual void printMetric(MetricType metricType, vector<float> values) = 0;
-    virtual void printLiveUpdate(float clock, LiveUpdateType eventType, Process *process, ReadyQueueList *RQList, Process *nextProcess = nullptr) = 0;
+    virtual void printDistribution(MetricType metricType, int index, vector<float> fractions) = 0;
+    virtual void printInterval(MetricType metricType, vector<float> means, vector<float> halfWidths) = 0;
+    virtual void printPercentiles(vector<MetricType> metricTypes, vector<float> quantiles, vector<vector<float>> values) = 0;
+    virtual void printLiveUpdate(SimTime clock, LiveUpdateType eventType, ProcessTable *processes, ProcessIndex process, ReadyQueueList *RQList, ProcessIndex nextProcess = NO_PROCESS) = 0;
 
     virtual ~Output() = default;
 };
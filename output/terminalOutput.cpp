@@ -2,6 +2,7 @@
 #include "../config.h"
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <unordered_map>
 
 unordered_map<Output::MetricType, string> metricTypeMap = {
@@ -9,6 +10,22 @@ unordered_map<Output::MetricType, string> metricTypeMap = {
   {Output::TOTAL_THROUGHPUT, "Total Throughput"},
   {Output::CPU_UTILIZATION, "CPU Utilization"},
   {Output::AVG_PROCESSES_IN_Q, "Average Number of Processes in the Ready Queue"},
+  {Output::PEAK_PROCESSES, "Peak Processes Allocated"},
+  {Output::PEAK_EVENTS, "Peak Pending Events"},
+  {Output::RQ_LENGTH_DISTRIBUTION, "Ready Queue Length Distribution"},
+  {Output::REPLICATIONS, "Replications"},
+  {Output::MIGRATIONS_IN, "Processes Migrated into the Ready Queue"},
+  {Output::MIGRATIONS_OUT, "Processes Migrated out of the Ready Queue"},
+  {Output::CLASS_AVG_TURN_TIME, "Average Turnaround Time by CPU Class"},
+  {Output::CLASS_THROUGHPUT, "Throughput by CPU Class"},
+  {Output::CLASS_UTILIZATION, "CPU Utilization by CPU Class"},
+  {Output::PROCESS_CLASS_AVG_TURN_TIME, "Average Turnaround Time by Process Class"},
+  {Output::PROCESS_CLASS_AVG_WAIT_TIME, "Average Waiting Time by Process Class"},
+  {Output::PROCESS_CLASS_AVG_SLOWDOWN, "Average Slowdown by Process Class"},
+  {Output::PROCESS_CLASS_THROUGHPUT, "Throughput by Process Class"},
+  {Output::TURN_TIME_PERCENTILES, "Turnaround Time"},
+  {Output::WAIT_TIME_PERCENTILES, "Waiting Time"},
+  {Output::RESPONSE_TIME_PERCENTILES, "Response Time"},
 };
 
 unordered_map<Output::MetricType, string> metricUnitMap = {
@@ -16,8 +33,40 @@ unordered_map<Output::MetricType, string> metricUnitMap = {
   {Output::TOTAL_THROUGHPUT, "processes per second"},
   {Output::CPU_UTILIZATION, ""},
   {Output::AVG_PROCESSES_IN_Q, "processes"},
+  {Output::PEAK_PROCESSES, "processes"},
+  {Output::PEAK_EVENTS, "events"},
+  {Output::RQ_LENGTH_DISTRIBUTION, "of the time"},
+  {Output::REPLICATIONS, "runs"},
+  {Output::MIGRATIONS_IN, "processes"},
+  {Output::MIGRATIONS_OUT, "processes"},
+  {Output::CLASS_AVG_TURN_TIME, "seconds"},
+  {Output::CLASS_THROUGHPUT, "processes per second"},
+  {Output::CLASS_UTILIZATION, ""},
+  {Output::PROCESS_CLASS_AVG_TURN_TIME, "seconds"},
+  {Output::PROCESS_CLASS_AVG_WAIT_TIME, "seconds"},
+  {Output::PROCESS_CLASS_AVG_SLOWDOWN, "times the service time"},
+  {Output::PROCESS_CLASS_THROUGHPUT, "processes per second"},
+  {Output::TURN_TIME_PERCENTILES, "seconds"},
+  {Output::WAIT_TIME_PERCENTILES, "seconds"},
+  {Output::RESPONSE_TIME_PERCENTILES, "seconds"},
 };
 
+// What each value of a metric with several values belongs to, CPU if not listed
+unordered_map<Output::MetricType, string> metricLabelMap = {
+  {Output::CLASS_AVG_TURN_TIME, "CPU Class"},
+  {Output::CLASS_THROUGHPUT, "CPU Class"},
+  {Output::CLASS_UTILIZATION, "CPU Class"},
+  {Output::PROCESS_CLASS_AVG_TURN_TIME, "Process Class"},
+  {Output::PROCESS_CLASS_AVG_WAIT_TIME, "Process Class"},
+  {Output::PROCESS_CLASS_AVG_SLOWDOWN, "Process Class"},
+  {Output::PROCESS_CLASS_THROUGHPUT, "Process Class"},
+};
+
+static string metricLabel(Output::MetricType metricType) {
+  auto label = metricLabelMap.find(metricType);
+  return label == metricLabelMap.end() ? "CPU" : label->second;
+}
+
 using namespace std;
 
 int TerminalOutput::lineLength = DEFAULT_LINE_LENGTH;
@@ -90,57 +139,127 @@ void TerminalOutput::printMetric(MetricType metricType, vector<float> values) {
   } else {
     cout << endl;
     for (int i = 0; i < values.size(); i++) {
-      cout << "    CPU " << i << ": " << values[i] << " " << metricUnitMap[metricType] << endl;
+      cout << "    " << metricLabel(metricType) << " " << i << ": " << values[i] << " " << metricUnitMap[metricType] << endl;
+    }
+  }
+  cout << endl;
+}
+
+// Prints the fraction of time spent at each value, the last value being that or more.
+void TerminalOutput::printDistribution(MetricType metricType, int index, vector<float> fractions) {
+  cout << setprecision(4) << metricTypeMap[metricType] << " (Ready Queue " << index << "): " << endl;
+  for (int i = 0; i < fractions.size(); i++) {
+    cout << "    " << (i == fractions.size() - 1 ? ">= " : "") << i << ": " << fractions[i] << " " << metricUnitMap[metricType] << endl;
+  }
+  cout << endl;
+}
+
+// Prints the mean and 95% confidence interval half-width of each value.
+void TerminalOutput::printInterval(MetricType metricType, vector<float> means, vector<float> halfWidths) {
+  cout << setprecision(4) << metricTypeMap[metricType] << ": ";
+  if (means.size() == 1) {
+    cout << means[0] << " +/- " << halfWidths[0] << " " << metricUnitMap[metricType] << endl;
+  } else {
+    cout << endl;
+    for (int i = 0; i < means.size(); i++) {
+      cout << "    " << metricLabel(metricType) << " " << i << ": " << means[i] << " +/- " << halfWidths[i] << " " << metricUnitMap[metricType] << endl;
     }
   }
   cout << endl;
 }
 
-void TerminalOutput::printLiveUpdate(float clock, LiveUpdateType eventType, Process *process, ReadyQueueList *RQList, Process *otherProcess) {
-  cout << fixed << setprecision(4) << clock << " | ";
+// Prints a table with a row per metric and a column per quantile, all in
+//   the first metric's unit.
+void TerminalOutput::printPercentiles(vector<MetricType> metricTypes, vector<float> quantiles, vector<vector<float>> values) {
+  const int labelWidth = 20;
+  const int columnWidth = 10;
+
+  cout << "Percentiles (" << metricUnitMap[metricTypes[0]] << "): " << endl;
+  cout << "    " << setw(labelWidth) << "";
+  for (float q : quantiles) {
+    ostringstream label;
+    label << "p" << q * 100;
+    cout << setw(columnWidth) << label.str();
+  }
+  cout << endl;
+
+  cout << defaultfloat << setprecision(4);
+  for (int i = 0; i < metricTypes.size(); i++) {
+    cout << "    " << left << setw(labelWidth) << metricTypeMap[metricTypes[i]] << right;
+    for (float value : values[i]) {
+      cout << setw(columnWidth) << value;
+    }
+    cout << endl;
+  }
+  cout << endl;
+}
+
+void TerminalOutput::printLiveUpdate(SimTime clock, LiveUpdateType eventType, ProcessTable *processes, ProcessIndex process, ReadyQueueList *RQList, ProcessIndex otherProcess) {
+  cout << fixed << setprecision(4) << toSeconds(clock) << " | ";
 
   switch (eventType) {
     case ARRIVAL_TO_CPU:
-      cout << "Process " << process->id << " arrived. CPU " << process->CPUindex 
-           << " was idle, so process " << process->id << " (" << process->serviceTime 
-           << ") started running on CPU " << process->CPUindex << ". ";
+      cout << "Process " << processes->id[process] << " arrived. CPU " << processes->CPUindex[process] 
+           << " was idle, so process " << processes->id[process] << " (" << toSeconds(processes->serviceTime[process]) 
+           << ") started running on CPU " << processes->CPUindex[process] << ". ";
       break;
     case ARRIVAL_PREEMPT_SRTF:
-      cout << "Process " << process->id << " arrived to CPU " << process->CPUindex << ". It's service time (" 
-           << process->serviceTime << ") was less than the time left for process " << otherProcess->id << " (" 
-           << otherProcess->timeLeft - (clock - otherProcess->lastRunTime) << ") so process " << otherProcess->id 
-           << " was preempted and added to Ready Queue " << otherProcess->RQindex << " (" 
-           << RQList->getRQSize(otherProcess->RQindex) << "). Process " << process->id 
-           << " started running on CPU " << process->CPUindex << ". ";
+      cout << "Process " << processes->id[process] << " arrived to CPU " << processes->CPUindex[process] << ". It's service time (" 
+           << toSeconds(processes->serviceTime[process]) << ") was less than the time left for process " << processes->id[otherProcess] << " (" 
+           << toSeconds(processes->timeLeft[otherProcess] - (clock - processes->lastRunTime[otherProcess])) << ") so process " << processes->id[otherProcess] 
+           << " was preempted and added to Ready Queue " << processes->RQindex[otherProcess] << " (" 
+           << RQList->getRQSize(processes->RQindex[otherProcess]) << "). Process " << processes->id[process] 
+           << " started running on CPU " << processes->CPUindex[process] << ". ";
+      break;
+    case ARRIVAL_PREEMPT_PRIORITY:
+      cout << "Process " << processes->id[process] << " arrived to CPU " << processes->CPUindex[process] << ". Process " 
+           << processes->id[otherProcess] << " was running at a lower priority, so it was preempted and added to Ready Queue " 
+           << processes->RQindex[otherProcess] << " (" << RQList->getRQSize(processes->RQindex[otherProcess]) << "). Process " 
+           << processes->id[process] << " started running on CPU " << processes->CPUindex[process] << ". ";
       break;
     case ARRIVAL_TO_RQ:
-      cout << "Process " << process->id << " arrived. ";
+      cout << "Process " << processes->id[process] << " arrived. ";
       if (RQList->getNumRQs() == 1) {
         cout << "No CPU was idle, so the process was added to Ready Queue (" << RQList->getRQSize(0) << "). ";
       } else {
-        cout << "CPU " << process->RQindex << " was busy, so the process was added to Ready Queue " 
-             << process->RQindex << " (" << RQList->getRQSize(process->RQindex) << "). ";
+        cout << "CPU " << processes->RQindex[process] << " was busy, so the process was added to Ready Queue " 
+             << processes->RQindex[process] << " (" << RQList->getRQSize(processes->RQindex[process]) << "). ";
       }
       break;
     case DEPARTURE_CPU_IDLE:
-      cout << "Process " << process->id << " departed from CPU " << process->CPUindex << ". ";
-      cout << "CPU " << process->CPUindex << " is now idle. ";
+      cout << "Process " << processes->id[process] << " departed from CPU " << processes->CPUindex[process] << ". ";
+      cout << "CPU " << processes->CPUindex[process] << " is now idle. ";
       break;
     case DEPARTURE_NEXT_PROCESS:
-      cout << "Process " << process->id << " departed from CPU " << process->CPUindex << ". ";
-      cout << "Process " << otherProcess->id << " (" << otherProcess->serviceTime << ") moving to CPU " 
-           << process->CPUindex << ". ";
+      cout << "Process " << processes->id[process] << " departed from CPU " << processes->CPUindex[process] << ". ";
+      cout << "Process " << processes->id[otherProcess] << " (" << toSeconds(processes->serviceTime[otherProcess]) << ") moving to CPU " 
+           << processes->CPUindex[process] << ". ";
+      break;
+    case DEPARTURE_PULL_MIGRATION:
+      cout << "Process " << processes->id[process] << " departed from CPU " << processes->CPUindex[process] << ". ";
+      cout << "Ready Queue " << processes->CPUindex[process] << " was empty, so process " << processes->id[otherProcess] << " (" 
+           << toSeconds(processes->serviceTime[otherProcess]) << ") was pulled from the longest Ready Queue and started running on CPU " 
+           << processes->CPUindex[process] << ". ";
       break;
     case PREEMPTION_INTERVAL:
-      cout << "Process " << process->id << " was preempted after running for " << clock - process->lastRunTime 
-           << " seconds on CPU " << process->CPUindex << ". ";
-      if (process->id == otherProcess->id) {
-        cout << "The Ready Queue was empty, so the process was restarted on CPU " << process->CPUindex << ". ";
+      cout << "Process " << processes->id[process] << " was preempted after running for " << toSeconds(clock - processes->lastRunTime[process]) 
+           << " seconds on CPU " << processes->CPUindex[process] << ". ";
+      if (processes->id[process] == processes->id[otherProcess]) {
+        cout << "The Ready Queue was empty, so the process was restarted on CPU " << processes->CPUindex[process] << ". ";
       } else {
-        cout << "The process was added to Ready Queue " << process->RQindex << " (" 
-             << RQList->getRQSize(process->RQindex) << ") and process " << otherProcess->id 
-             << " (" << otherProcess->serviceTime << ") started running on CPU " << otherProcess->CPUindex << ". ";
+        cout << "The process was added to Ready Queue " << processes->RQindex[process] << " (" 
+             << RQList->getRQSize(processes->RQindex[process]) << ") and process " << processes->id[otherProcess] 
+             << " (" << toSeconds(processes->serviceTime[otherProcess]) << ") started running on CPU " << processes->CPUindex[otherProcess] << ". ";
       }
+      break;
+    case PUSH_MIGRATION_TO_CPU:
+      cout << "Process " << processes->id[process] << " (" << toSeconds(processes->timeLeft[process]) << ") was pushed from the longest Ready Queue to idle CPU " 
+           << processes->CPUindex[process] << " and started running. ";
+      break;
+    case PUSH_MIGRATION_TO_RQ:
+      cout << "Process " << processes->id[process] << " (" << toSeconds(processes->timeLeft[process]) << ") was pushed from the longest Ready Queue to Ready Queue " 
+           << processes->RQindex[process] << " (" << RQList->getRQSize(processes->RQindex[process]) << "). ";
+      break;
   }
 
   cout << endl;
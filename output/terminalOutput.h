@@ -29,7 +29,10 @@ class TerminalOutput : public Output {
     void printTitle();
     void printHeader(string);
     void printMetric(MetricType metricType, vector<float> values);
-    void printLiveUpdate(float clock, LiveUpdateType eventType, Process *process, ReadyQueueList *RQList, Process *nextProcess);
+    void printDistribution(MetricType metricType, int index, vector<float> fractions);
+    void printInterval(MetricType metricType, vector<float> means, vector<float> halfWidths);
+    void printPercentiles(vector<MetricType> metricTypes, vector<float> quantiles, vector<vector<float>> values);
+    void printLiveUpdate(SimTime clock, LiveUpdateType eventType, ProcessTable *processes, ProcessIndex process, ReadyQueueList *RQList, ProcessIndex nextProcess);
 };
 
 #endif // TERMINAL_OUTPUT_H
\ No newline at end of file
@@ -1,6 +1,6 @@
 #include "../../output/output.h"
 #include "../../output/terminalOutput.h"
-#include "../../processes/Process.h"
+#include "../../processes/ProcessTable.h"
 #include "../../processes/ReadyQueueList.h"
 
 int main() {
@@ -22,25 +22,42 @@ int main() {
   out->printMetric(Output::TOTAL_THROUGHPUT, {100.0});
   out->printMetric(Output::CPU_UTILIZATION, {0.5});
   out->printMetric(Output::AVG_PROCESSES_IN_Q, {10.0});
+  out->printMetric(Output::MIGRATIONS_IN, {3.0, 0.0});
+  out->printMetric(Output::MIGRATIONS_OUT, {0.0, 3.0});
+  out->printMetric(Output::CLASS_AVG_TURN_TIME, {4.0, 6.0});
+  out->printMetric(Output::CLASS_UTILIZATION, {0.7, 0.9});
+  out->printMetric(Output::PROCESS_CLASS_AVG_WAIT_TIME, {0.2, 1.5});
+  out->printMetric(Output::PROCESS_CLASS_AVG_SLOWDOWN, {1.1, 2.4});
 
-  Process* process = new Process(10.0, 10.0);
-  process->CPUindex = 0;
-  process->RQindex = 0;
-  Process* process2 = new Process(15.0, 15.0);
-  process2->CPUindex = 0;
-  process2->RQindex = 0;
-  ReadyQueueList* RQList = new ReadyQueueList(1, 0);
+  out->printInterval(Output::AVG_TURN_TIME, {10.0}, {0.5});
+  out->printInterval(Output::CPU_UTILIZATION, {0.5, 0.6}, {0.01, 0.02});
+
+  out->printPercentiles({Output::TURN_TIME_PERCENTILES, Output::WAIT_TIME_PERCENTILES, Output::RESPONSE_TIME_PERCENTILES},
+                        {0.5, 0.99, 0.999}, {{1.5, 12.25, 40.0}, {0.5, 9.75, 35.125}, {0.25, 8.5, 30.0}});
+
+  ProcessTable* processes = new ProcessTable();
+  ProcessIndex process = processes->create(0, fromSeconds(10.0), fromSeconds(10.0));
+  processes->CPUindex[process] = 0;
+  processes->RQindex[process] = 0;
+  ProcessIndex process2 = processes->create(1, fromSeconds(15.0), fromSeconds(15.0));
+  processes->CPUindex[process2] = 0;
+  processes->RQindex[process2] = 0;
+  ReadyQueueList* RQList = new PolicyReadyQueueList<SJFPolicy>(processes, SchedulerParameters(), 1);
   
-  out->printLiveUpdate(10.0, Output::ARRIVAL_TO_CPU, process, RQList, nullptr);
-  out->printLiveUpdate(10.0, Output::ARRIVAL_PREEMPT_SRTF, process, RQList, process2);
-  out->printLiveUpdate(10.0, Output::ARRIVAL_TO_RQ, process, RQList, nullptr);
-  out->printLiveUpdate(10.0, Output::DEPARTURE_CPU_IDLE, process, RQList, nullptr);
-  out->printLiveUpdate(10.0, Output::DEPARTURE_NEXT_PROCESS, process, RQList, process2);
-  out->printLiveUpdate(10.0, Output::PREEMPTION_INTERVAL, process, RQList, process);
-  out->printLiveUpdate(10.0, Output::PREEMPTION_INTERVAL, process, RQList, process2);
+  out->printLiveUpdate(fromSeconds(10.0), Output::ARRIVAL_TO_CPU, processes, process, RQList, NO_PROCESS);
+  out->printLiveUpdate(fromSeconds(10.0), Output::ARRIVAL_PREEMPT_SRTF, processes, process, RQList, process2);
+  out->printLiveUpdate(fromSeconds(10.0), Output::ARRIVAL_PREEMPT_PRIORITY, processes, process, RQList, process2);
+  out->printLiveUpdate(fromSeconds(10.0), Output::ARRIVAL_TO_RQ, processes, process, RQList, NO_PROCESS);
+  out->printLiveUpdate(fromSeconds(10.0), Output::DEPARTURE_CPU_IDLE, processes, process, RQList, NO_PROCESS);
+  out->printLiveUpdate(fromSeconds(10.0), Output::DEPARTURE_NEXT_PROCESS, processes, process, RQList, process2);
+  out->printLiveUpdate(fromSeconds(10.0), Output::DEPARTURE_PULL_MIGRATION, processes, process, RQList, process2);
+  out->printLiveUpdate(fromSeconds(10.0), Output::PREEMPTION_INTERVAL, processes, process, RQList, process);
+  out->printLiveUpdate(fromSeconds(10.0), Output::PREEMPTION_INTERVAL, processes, process, RQList, process2);
+  out->printLiveUpdate(fromSeconds(10.0), Output::PUSH_MIGRATION_TO_CPU, processes, process, RQList);
+  out->printLiveUpdate(fromSeconds(10.0), Output::PUSH_MIGRATION_TO_RQ, processes, process, RQList);
   
-  delete process;
   delete RQList;
+  delete processes;
   delete out;
 
   return 0;
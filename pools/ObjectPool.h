@@ -0,0 +1,87 @@
+#ifndef OBJECTPOOL_H
+#define OBJECTPOOL_H
+
+#include <vector>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+using namespace std;
+
+// ====================================================================
+// Slab allocator with a free list for objects of one type.
+// Objects are carved out of fixed-size slabs and never move, so pointers
+//   to them stay valid until destroy() is called. Destroyed objects are
+//   recycled by the next create(), so once the pool has grown to the
+//   peak number of live objects it makes no further heap allocations.
+// All slabs are released when the pool is deleted, including objects
+//   that were never destroyed.
+template <typename T>
+class ObjectPool {
+  static_assert(is_trivially_destructible<T>::value, "ObjectPool releases slabs without running destructors.");
+
+  private:
+    static const int SLAB_SIZE = 1024;   // Objects per slab
+
+    union Slot {
+      Slot *nextFree;
+      alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    vector<Slot *> slabs;
+    Slot *freeList;
+    int numInUse;
+    int highWaterMark;
+
+    void addSlab() {
+      Slot *slab = new Slot[SLAB_SIZE];
+      for (int i = 0; i < SLAB_SIZE - 1; i++) {
+        slab[i].nextFree = &slab[i + 1];
+      }
+      slab[SLAB_SIZE - 1].nextFree = freeList;
+      freeList = slab;
+      slabs.push_back(slab);
+    }
+
+  public:
+    ObjectPool() {
+      freeList = nullptr;
+      numInUse = 0;
+      highWaterMark = 0;
+    }
+
+    ~ObjectPool() {
+      for (int i = 0; i < slabs.size(); i++) {
+        delete[] slabs[i];
+      }
+    }
+
+    ObjectPool(const ObjectPool &) = delete;
+    ObjectPool &operator=(const ObjectPool &) = delete;
+
+    // Constructs a new object in a free slot, growing the pool by a slab if needed.
+    template <typename... Args>
+    T* create(Args &&... args) {
+      if (!freeList) addSlab();
+      Slot *slot = freeList;
+      freeList = slot->nextFree;
+
+      numInUse++;
+      if (numInUse > highWaterMark) highWaterMark = numInUse;
+      return new (slot->storage) T(forward<Args>(args)...);
+    }
+
+    // Returns an object's slot to the free list.
+    void destroy(T *object) {
+      Slot *slot = reinterpret_cast<Slot *>(object);
+      slot->nextFree = freeList;
+      freeList = slot;
+      numInUse--;
+    }
+
+    int getNumInUse() { return numInUse; }
+    int getHighWaterMark() { return highWaterMark; }
+    int getCapacity() { return slabs.size() * SLAB_SIZE; }
+};
+
+#endif // OBJECTPOOL_H
@@ -0,0 +1,13 @@
+#ifndef AFFINITYMASK_H
+#define AFFINITYMASK_H
+
+#include <cstdint>
+
+// Set of CPU classes a process may run on, bit c for class c.
+// Masks are over classes rather than single CPUs, so they stay one word
+//   however many CPUs there are.
+typedef uint64_t AffinityMask;
+const AffinityMask ALL_CPU_CLASSES = ~AffinityMask(0);
+const int MAX_CPU_CLASSES = 64;
+
+#endif // AFFINITYMASK_H
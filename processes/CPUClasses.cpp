@@ -0,0 +1,128 @@
+#include "CPUClasses.h"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+static vector<string> split(const string &s, char separator) {
+  vector<string> parts;
+  stringstream stream(s);
+  string part;
+  while (getline(stream, part, separator)) {
+    parts.push_back(part);
+  }
+  return parts;
+}
+
+vector<CPUClass> parseCPUClasses(const string &spec, int numCPUs) {
+  if (spec.empty()) {
+    return {{numCPUs, 1.0}};
+  }
+
+  vector<CPUClass> classes;
+  int total = 0;
+  for (const string &entry : split(spec, ';')) {
+    size_t x = entry.find('x');
+    CPUClass c;
+    try {
+      size_t countEnd, speedEnd;
+      c.count = stoi(entry.substr(0, x), &countEnd);
+      c.speed = stod(entry.substr(x + 1), &speedEnd);
+      if (x == string::npos || countEnd != x || speedEnd != entry.size() - x - 1) throw invalid_argument(entry);
+    }
+    catch (const logic_error &) {
+      throw runtime_error("Invalid CPU class " + entry + ", expected count x speed.");
+    }
+    if (c.count <= 0 || !(c.speed > 0) || isinf(c.speed)) {
+      throw runtime_error("CPU class " + entry + " needs a positive count and speed.");
+    }
+    classes.push_back(c);
+    total += c.count;
+  }
+  if (classes.size() > MAX_CPU_CLASSES) {
+    throw runtime_error("At most " + to_string(MAX_CPU_CLASSES) + " CPU classes are supported.");
+  }
+  if (total != numCPUs) {
+    throw runtime_error("CPU classes have " + to_string(total) + " CPUs, but the system has " + to_string(numCPUs) + ".");
+  }
+  return classes;
+}
+
+
+// ====================================================================
+AffinityMix::AffinityMix(const string &spec, int numClasses) {
+  AffinityMask existing = numClasses >= MAX_CPU_CLASSES ? ALL_CPU_CLASSES : (AffinityMask(1) << numClasses) - 1;
+  double total = 0;
+
+  if (spec.empty()) {
+    cumulativeWeights.push_back(1.0);
+    masks.push_back(ALL_CPU_CLASSES);
+    return;
+  }
+
+  for (const string &entry : split(spec, ';')) {
+    size_t colon = entry.find(':');
+    if (colon == string::npos) {
+      throw runtime_error("Invalid affinity " + entry + ", expected weight:classes.");
+    }
+    double weight;
+    try {
+      weight = stod(entry.substr(0, colon));
+    }
+    catch (const logic_error &) {
+      throw runtime_error("Invalid affinity weight in " + entry + ".");
+    }
+    if (!(weight > 0) || isinf(weight)) {
+      throw runtime_error("Affinity weights must be positive.");
+    }
+
+    string classList = entry.substr(colon + 1);
+    AffinityMask mask = 0;
+    if (classList == "*") {
+      mask = ALL_CPU_CLASSES;
+    }
+    else {
+      for (const string &c : split(classList, '+')) {
+        int index;
+        try {
+          size_t end;
+          index = stoi(c, &end);
+          if (end != c.size()) throw invalid_argument(c);
+        }
+        catch (const logic_error &) {
+          throw runtime_error("Invalid CPU class " + c + " in affinity " + entry + ".");
+        }
+        if (index < 0 || index >= numClasses) {
+          throw runtime_error("Affinity " + entry + " names CPU class " + c + ", but there are only " + to_string(numClasses) + ".");
+        }
+        mask |= AffinityMask(1) << index;
+      }
+    }
+    if ((mask & existing) == 0) {
+      throw runtime_error("Affinity " + entry + " allows no CPU class.");
+    }
+
+    total += weight;
+    cumulativeWeights.push_back(total);
+    masks.push_back((mask & existing) == existing ? ALL_CPU_CLASSES : mask);
+  }
+
+  for (double &w : cumulativeWeights) {
+    w /= total;
+  }
+}
+
+bool AffinityMix::restrictsAny() {
+  for (AffinityMask mask : masks) {
+    if (mask != ALL_CPU_CLASSES) return true;
+  }
+  return false;
+}
+
+AffinityMask AffinityMix::sample(Xoshiro256 &stream) {
+  if (masks.size() == 1) return masks[0];
+  double u = stream.nextOpenUniform();
+  for (int i = 0; i < masks.size() - 1; i++) {
+    if (u <= cumulativeWeights[i]) return masks[i];
+  }
+  return masks.back();
+}
@@ -0,0 +1,51 @@
+#ifndef CPUCLASSES_H
+#define CPUCLASSES_H
+
+#include "AffinityMask.h"
+#include "../generators/Xoshiro256.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// A group of identical CPUs. Speed scales how fast they work through
+//   service time: a process needing 1 second of service runs for
+//   1 / speed seconds on one of them.
+struct CPUClass {
+  int count;
+  double speed;
+};
+
+// Parses a list of classes separated by semicolons, each count x speed,
+//   e.g. "4x2;12x1" for 4 CPUs at twice the speed followed by 12 at the
+//   normal speed. Classes are numbered in order and own consecutive CPU
+//   indices. An empty spec is numCPUs CPUs at speed 1.
+// Throws runtime_error if the spec is invalid or the counts do not add up
+//   to numCPUs.
+vector<CPUClass> parseCPUClasses(const string &spec, int numCPUs);
+
+
+// ====================================================================
+// Mix of affinity masks given to arriving processes.
+// Parsed from entries separated by semicolons, each weight:classes with the
+//   classes joined by + or * for all, e.g. "0.3:0;0.7:*" pins 30% of
+//   processes to class 0 and lets the rest run anywhere. Weights are
+//   relative. An empty spec lets every process run anywhere.
+class AffinityMix {
+  private:
+    vector<double> cumulativeWeights;
+    vector<AffinityMask> masks;
+
+  public:
+    // Throws runtime_error if the spec is invalid or a mask has no class
+    //   below numClasses
+    AffinityMix(const string &spec, int numClasses);
+
+    // False if every process may run on every class
+    bool restrictsAny();
+
+    AffinityMask sample(Xoshiro256 &);
+};
+
+#endif // CPUCLASSES_H
@@ -1,50 +1,158 @@
 #include "CPUList.h"
 
-CPUList::CPUList(int numCPUs) {
-  for (int i = 0; i < numCPUs; i++) {
-    CPUs.push_back(nullptr);
-  }
-}
+CPUList::CPUList(ProcessTable *processes, int numCPUs) : CPUList(processes, vector<CPUClass>{{numCPUs, 1.0}}) {}
 
-CPUList::~CPUList() {
-  for (int i = 0; i < CPUs.size(); i++) {
-    if (CPUs[i]) {
-      delete CPUs[i];
+CPUList::CPUList(ProcessTable *processes, const vector<CPUClass> &cpuClasses) {
+  this->processes = processes;
+  idleCPUs.resize(cpuClasses.size());
+  for (int c = 0; c < cpuClasses.size(); c++) {
+    classStarts.push_back(CPUs.size());
+    for (int i = 0; i < cpuClasses[c].count; i++) {
+      int cpuIndex = CPUs.size();
+      CPUs.push_back(NO_PROCESS);
+      speeds.push_back(cpuClasses[c].speed);
+      classes.push_back(c);
+      idlePosition.push_back(idleCPUs[c].size());
+      idleCPUs[c].push_back(cpuIndex);
     }
   }
+  classStarts.push_back(CPUs.size());
+  numIdle = CPUs.size();
 }
 
+// Processes on the CPUs are owned by the simulation's process table.
+CPUList::~CPUList() {}
+
 int CPUList::getNumCPUs() {
   return CPUs.size();
 }
 
 bool CPUList::isCPUIdle(int cpuIndex = 0) {
-  return CPUs[cpuIndex] == nullptr;
+  return CPUs[cpuIndex] == NO_PROCESS;
 }
 
-vector<int> CPUList::getIdleCPUs() {
-  vector<int> idleCPUs;
-  for (int i = 0; i < CPUs.size(); i++) {
-    if (CPUs[i] == nullptr) {
-      idleCPUs.push_back(i);
-    }
+int CPUList::getNumIdleCPUs() {
+  return numIdle;
+}
+
+// Returns the k-th idle CPU, 0 <= k < getNumIdleCPUs(). The order of the
+//   idle CPUs is arbitrary.
+int CPUList::getIdleCPU(int k) {
+  return getIdleCPU(ALL_CPU_CLASSES, k);
+}
+
+// Number of idle CPUs in the classes of mask.
+int CPUList::getNumIdleCPUs(AffinityMask mask) {
+  if (mask == ALL_CPU_CLASSES) return numIdle;
+  int count = 0;
+  for (int c = 0; c < idleCPUs.size(); c++) {
+    if (mask >> c & 1) count += idleCPUs[c].size();
+  }
+  return count;
+}
+
+// Returns the k-th idle CPU in the classes of mask, 0 <= k < getNumIdleCPUs(mask).
+int CPUList::getIdleCPU(AffinityMask mask, int k) {
+  for (int c = 0; ; c++) {
+    if (!(mask >> c & 1)) continue;
+    if (k < idleCPUs[c].size()) return idleCPUs[c][k];
+    k -= idleCPUs[c].size();
+  }
+}
+
+int CPUList::getNumClasses() {
+  return idleCPUs.size();
+}
+
+int CPUList::getCPUClass(int cpuIndex) {
+  return classes[cpuIndex];
+}
+
+int CPUList::getClassSize(int classIndex) {
+  return classStarts[classIndex + 1] - classStarts[classIndex];
+}
+
+// Mask holding only the given class.
+AffinityMask CPUList::getClassMask(int classIndex) {
+  return getNumClasses() == 1 ? ALL_CPU_CLASSES : AffinityMask(1) << classIndex;
+}
+
+// Number of CPUs in the classes of mask.
+int CPUList::getNumAllowedCPUs(AffinityMask mask) {
+  if (mask == ALL_CPU_CLASSES) return CPUs.size();
+  int count = 0;
+  for (int c = 0; c < getNumClasses(); c++) {
+    if (mask >> c & 1) count += getClassSize(c);
+  }
+  return count;
+}
+
+// Returns the k-th CPU in the classes of mask, by index.
+int CPUList::getAllowedCPU(AffinityMask mask, int k) {
+  if (mask == ALL_CPU_CLASSES) return k;
+  for (int c = 0; ; c++) {
+    if (!(mask >> c & 1)) continue;
+    if (k < getClassSize(c)) return classStarts[c] + k;
+    k -= getClassSize(c);
   }
-  return idleCPUs;
 }
 
-void CPUList::assignProcessToCPU(float clock, Process *process, int cpuIndex = 0) {
+bool CPUList::isCPUAllowed(AffinityMask mask, int cpuIndex) {
+  return mask >> classes[cpuIndex] & 1;
+}
+
+double CPUList::getCPUSpeed(int cpuIndex) {
+  return speeds[cpuIndex];
+}
+
+// Time the CPU takes to do the given amount of service.
+SimTime CPUList::workToTime(int cpuIndex, SimTime work) {
+  if (speeds[cpuIndex] == 1.0) return work;
+  return fromSeconds(toSeconds(work) / speeds[cpuIndex]);
+}
+
+// Service the CPU does in the given amount of time.
+SimTime CPUList::timeToWork(int cpuIndex, SimTime time) {
+  if (speeds[cpuIndex] == 1.0) return time;
+  return fromSeconds(toSeconds(time) * speeds[cpuIndex]);
+}
+
+void CPUList::markBusy(int cpuIndex) {
+  int pos = idlePosition[cpuIndex];
+  if (pos == -1) return;
+  vector<int> &idle = idleCPUs[classes[cpuIndex]];
+  int last = idle.back();
+  idle[pos] = last;
+  idlePosition[last] = pos;
+  idle.pop_back();
+  idlePosition[cpuIndex] = -1;
+  numIdle--;
+}
+
+void CPUList::markIdle(int cpuIndex) {
+  if (idlePosition[cpuIndex] != -1) return;
+  vector<int> &idle = idleCPUs[classes[cpuIndex]];
+  idlePosition[cpuIndex] = idle.size();
+  idle.push_back(cpuIndex);
+  numIdle++;
+}
+
+void CPUList::assignProcessToCPU(SimTime clock, ProcessIndex process, int cpuIndex = 0) {
   CPUs[cpuIndex] = process;
-  if (process) process->CPUindex = cpuIndex;
-  process->lastRunTime = clock;
+  markBusy(cpuIndex);
+  processes->CPUindex[process] = cpuIndex;
+  processes->lastRunTime[process] = clock;
 }
 
-Process* CPUList::getProcessOnCPU(int cpuIndex = 0) {
+ProcessIndex CPUList::getProcessOnCPU(int cpuIndex = 0) {
   return CPUs[cpuIndex];
 }
 
-Process* CPUList::removeProcessFromCPU(float clock, int cpuIndex = 0) {
-  Process *p = CPUs[cpuIndex];
-  p->timeLeft -= clock - p->lastRunTime;
-  CPUs[cpuIndex] = nullptr;
+// Takes the process off the CPU, counting the service it got while running.
+ProcessIndex CPUList::removeProcessFromCPU(SimTime clock, int cpuIndex = 0) {
+  ProcessIndex p = CPUs[cpuIndex];
+  processes->timeLeft[p] -= timeToWork(cpuIndex, clock - processes->lastRunTime[p]);
+  CPUs[cpuIndex] = NO_PROCESS;
+  markIdle(cpuIndex);
   return p;
-}
\ No newline at end of file
+}
@@ -1,28 +1,61 @@
 #ifndef CPULIST_H
 #define CPULIST_H
 
-#include "Process.h"
+#include "ProcessTable.h"
+#include "CPUClasses.h"
 #include <vector>
 
 using namespace std;
 
 // ====================================================================
 // CPU List structure 
+// CPUs are grouped into classes of consecutive indices, each with its own
+//   speed (see CPUClasses.h). Idle CPUs are also kept in an unordered array
+//   per class, with each CPU's position in it, so picking the k-th idle
+//   CPU and marking a CPU busy or idle are all O(1) (O(classes) when
+//   restricted to an affinity mask). A CPU going busy is swapped with the
+//   last idle CPU of its class and popped.
 class CPUList {
   private:
-    vector<Process *> CPUs;
+    ProcessTable *processes;
+    vector<ProcessIndex> CPUs;
+    vector<double> speeds;
+    vector<int> classes;              // Class of each CPU
+    vector<int> classStarts;          // First CPU of each class, then the number of CPUs
+    vector<vector<int>> idleCPUs;     // Per class
+    vector<int> idlePosition;         // Index of each CPU in its class's idleCPUs, -1 if busy
+    int numIdle;
+
+    void markBusy(int);
+    void markIdle(int);
   
   public:
-    CPUList (int = 1);
+    CPUList (ProcessTable *, int = 1);
+    CPUList (ProcessTable *, const vector<CPUClass> &);
     ~CPUList();
   
     int getNumCPUs();
     bool isCPUIdle(int);
-    vector<int> getIdleCPUs();
+    int getNumIdleCPUs();
+    int getIdleCPU(int);
+    int getNumIdleCPUs(AffinityMask);
+    int getIdleCPU(AffinityMask, int);
+
+    int getNumClasses();
+    int getCPUClass(int);
+    int getClassSize(int);
+    AffinityMask getClassMask(int);
+    int getNumAllowedCPUs(AffinityMask);
+    int getAllowedCPU(AffinityMask, int);
+    bool isCPUAllowed(AffinityMask, int);
+
+    double getCPUSpeed(int);
+    SimTime workToTime(int, SimTime);
+    SimTime timeToWork(int, SimTime);
   
-    void assignProcessToCPU(float, Process *, int);
-    Process* getProcessOnCPU(int);
-    Process* removeProcessFromCPU(float, int);
+    void assignProcessToCPU(SimTime, ProcessIndex, int);
+    ProcessIndex getProcessOnCPU(int);
+    ProcessIndex removeProcessFromCPU(SimTime, int);
   };
 
-#endif // CPULIST_H
\ No newline at end of file
+#endif // CPULIST_H
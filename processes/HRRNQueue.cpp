@@ -0,0 +1,150 @@
+#include "HRRNQueue.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+// Relative margin kept between two response ratios before a certificate
+//   expires. It is far larger than the rounding error of the ratio, so
+//   while a certificate holds the comparison cannot flip.
+static const double CERTIFICATE_MARGIN = 1e-5;
+
+static const double NEVER = numeric_limits<double>::infinity();
+static const double NOW = -numeric_limits<double>::infinity();
+
+HRRNQueue::HRRNQueue(ProcessTable *processes) {
+  this->processes = processes;
+  capacity = INITIAL_CAPACITY;
+  size = 0;
+  nextSeq = 0;
+  leaves = vector<Leaf>(capacity, {NO_PROCESS, 0});
+  for (int i = capacity - 1; i >= 0; i--) {
+    freeLeaves.push_back(i);
+  }
+  winner = vector<int>(2 * capacity, -1);
+  failTime = vector<double>(2 * capacity, NEVER);
+  minFailTime = vector<double>(2 * capacity, NEVER);
+}
+
+double HRRNQueue::responseRatio(int leaf, double now) {
+  ProcessIndex p = leaves[leaf].process;
+  return 1 + (now - toSeconds(processes->arrivalTime[p])) / toSeconds(processes->serviceTime[p]);
+}
+
+// True if leaf a should be dequeued before leaf b at the given time.
+bool HRRNQueue::beats(int a, int b, double now) {
+  double RRa = responseRatio(a, now);
+  double RRb = responseRatio(b, now);
+  return RRa > RRb || (RRa == RRb && leaves[a].seq < leaves[b].seq);
+}
+
+// Returns the time until which leaf w is certain to still beat leaf l, given
+//   that it beats l at the given time. This is when the exact gap between
+//   their ratios shrinks to the certificate margin.
+double HRRNQueue::certificate(int w, int l, double now) {
+  ProcessIndex pw = leaves[w].process;
+  ProcessIndex pl = leaves[l].process;
+  if (processes->arrivalTime[pw] == processes->arrivalTime[pl] && processes->serviceTime[pw] == processes->serviceTime[pl]) {
+    return NEVER;   // Identical ratios forever, w wins every tie
+  }
+
+  // gap(t) = RRw(t) - RRl(t) - margin * RRw(t) = slope * t + intercept
+  double mw = 1.0 / toSeconds(processes->serviceTime[pw]);
+  double ml = 1.0 / toSeconds(processes->serviceTime[pl]);
+  double aw = toSeconds(processes->arrivalTime[pw]);
+  double al = toSeconds(processes->arrivalTime[pl]);
+  double slope = mw - ml - CERTIFICATE_MARGIN * mw;
+  double intercept = ml * al - mw * aw - CERTIFICATE_MARGIN * (1 - mw * aw);
+
+  if (slope * now + intercept <= 0) return NOW;
+  if (slope >= 0) return NEVER;
+  return -intercept / slope;
+}
+
+// Replays the match at an internal node from its children's winners.
+void HRRNQueue::recompute(int node, double now) {
+  int a = winner[2 * node];
+  int b = winner[2 * node + 1];
+  if (a == -1 || b == -1) {
+    winner[node] = a == -1 ? b : a;
+    failTime[node] = NEVER;
+  }
+  else if (beats(a, b, now)) {
+    winner[node] = a;
+    failTime[node] = certificate(a, b, now);
+  }
+  else {
+    winner[node] = b;
+    failTime[node] = certificate(b, a, now);
+  }
+  double childMin = min(minFailTime[2 * node], minFailTime[2 * node + 1]);
+  minFailTime[node] = min(failTime[node], childMin);
+}
+
+// Brings the subtree up to date for the given time, only descending into
+//   subtrees holding an expired certificate or a changed leaf.
+void HRRNQueue::advance(int node, double now) {
+  if (node >= capacity || minFailTime[node] > now) return;
+  advance(2 * node, now);
+  advance(2 * node + 1, now);
+  recompute(node, now);
+}
+
+// Marks every ancestor of a leaf for recomputation at the next dequeue.
+void HRRNQueue::invalidatePath(int leaf) {
+  int node = capacity + leaf;
+  winner[node] = leaves[leaf].process != NO_PROCESS ? leaf : -1;
+  for (node /= 2; node >= 1; node /= 2) {
+    failTime[node] = NOW;
+    minFailTime[node] = NOW;
+  }
+}
+
+// Doubles the number of leaves and rebuilds the tree.
+void HRRNQueue::grow() {
+  int oldCapacity = capacity;
+  capacity *= 2;
+  leaves.resize(capacity, {NO_PROCESS, 0});
+  for (int i = capacity - 1; i >= oldCapacity; i--) {
+    freeLeaves.push_back(i);
+  }
+
+  winner.assign(2 * capacity, -1);
+  failTime.assign(2 * capacity, NOW);
+  minFailTime.assign(2 * capacity, NOW);
+  for (int i = 0; i < capacity; i++) {
+    winner[capacity + i] = leaves[i].process != NO_PROCESS ? i : -1;
+    failTime[capacity + i] = NEVER;
+    minFailTime[capacity + i] = NEVER;
+  }
+}
+
+void HRRNQueue::insert(ProcessIndex process) {
+  if (freeLeaves.empty()) grow();
+  int leaf = freeLeaves.back();
+  freeLeaves.pop_back();
+
+  leaves[leaf].process = process;
+  leaves[leaf].seq = nextSeq++;
+  invalidatePath(leaf);
+  size++;
+}
+
+// Removes and returns the process with the highest response ratio at clock.
+ProcessIndex HRRNQueue::dequeue(SimTime clock) {
+  if (size == 0) {
+    throw runtime_error("Error: Attempted to remove process from empty Ready Queue.");
+  }
+  advance(1, toSeconds(clock));
+
+  int leaf = winner[1];
+  ProcessIndex p = leaves[leaf].process;
+  leaves[leaf].process = NO_PROCESS;
+  freeLeaves.push_back(leaf);
+  invalidatePath(leaf);
+  size--;
+  return p;
+}
+
+int HRRNQueue::getSize() {
+  return size;
+}
@@ -0,0 +1,58 @@
+#ifndef HRRNQUEUE_H
+#define HRRNQUEUE_H
+
+#include "ProcessTable.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Ready Queue for HRRN, stored as a kinetic tournament tree.
+// A process's response ratio 1 + (clock - arrivalTime) / serviceTime is a
+//   line in the clock with slope 1 / serviceTime. Every internal node keeps
+//   the winner of its subtree (the highest response ratio, ties going to
+//   the earliest inserted process) along with the time at which that
+//   winner could be overtaken by the runner-up. A dequeue only revisits
+//   nodes whose certificates have expired or whose subtree changed, instead
+//   of scanning the whole queue. Winners are always decided by the same
+//   comparison a linear scan would use, so the selected process is
+//   identical. Internally times are in seconds.
+class HRRNQueue {
+  private:
+    static const int INITIAL_CAPACITY = 16;
+
+    ProcessTable *processes;
+
+    struct Leaf {
+      ProcessIndex process;   // NO_PROCESS if the leaf is free
+      long long seq;      // Insertion order, breaks ties between equal ratios
+    };
+
+    vector<Leaf> leaves;
+    vector<int> freeLeaves;
+    int capacity;         // Number of leaves, a power of two
+    int size;
+    long long nextSeq;
+
+    // Tree nodes are numbered from 1, the leaves are nodes capacity..2*capacity-1
+    vector<int> winner;         // Winning leaf of each subtree, -1 if empty
+    vector<double> failTime;    // Time until which the node's winner is certain
+    vector<double> minFailTime; // Earliest failTime in the node's subtree
+
+    double responseRatio(int, double);
+    bool beats(int, int, double);
+    double certificate(int, int, double);
+    void recompute(int, double);
+    void advance(int, double);
+    void invalidatePath(int);
+    void grow();
+
+  public:
+    HRRNQueue(ProcessTable *);
+
+    void insert(ProcessIndex);
+    ProcessIndex dequeue(SimTime);
+    int getSize();
+};
+
+#endif // HRRNQUEUE_H
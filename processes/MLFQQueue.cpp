@@ -0,0 +1,114 @@
+#include "MLFQQueue.h"
+#include "../config.h"
+#include <cmath>
+#include <stdexcept>
+
+MLFQQueue::MLFQQueue(ProcessTable *processes) {
+  this->processes = processes;
+  nonEmptyLevels = 0;
+  epoch = 0;
+  size = 0;
+  setParameters(MLFQ_LEVELS, fromSeconds(MLFQ_BASE_QUANTUM), MLFQ_BOOST_PERIOD);
+}
+
+// Only valid while the queue is empty.
+void MLFQQueue::setParameters(int numLevels, SimTime baseQuantum, double boostPeriod) {
+  if (numLevels < 1 || numLevels > MAX_LEVELS || baseQuantum <= SimTime() || boostPeriod < 0) {
+    throw runtime_error("Invalid MLFQ parameters.");
+  }
+  this->numLevels = numLevels;
+  this->baseQuantum = baseQuantum;
+  this->boostPeriod = boostPeriod;
+  heads.assign(numLevels, NO_PROCESS);
+  tails.assign(numLevels, NO_PROCESS);
+}
+
+long long MLFQQueue::epochAt(SimTime clock) {
+  if (boostPeriod == 0) return 0;
+  return (long long)floor(toSeconds(clock) / boostPeriod);
+}
+
+// Moves every waiting process to level 0, keeping the order of levels and
+//   the FIFO order within each level.
+void MLFQQueue::boost(long long newEpoch) {
+  epoch = newEpoch;
+  for (int l = 1; l < numLevels; l++) {
+    if (heads[l] == NO_PROCESS) continue;
+    if (heads[0] == NO_PROCESS) {
+      heads[0] = heads[l];
+    }
+    else {
+      processes->next[tails[0]] = heads[l];
+    }
+    tails[0] = tails[l];
+    heads[l] = NO_PROCESS;
+    tails[l] = NO_PROCESS;
+  }
+  nonEmptyLevels = size > 0 ? 1 : 0;
+}
+
+// Current level of a process, 0 if it was set before the latest boost.
+int MLFQQueue::getLevel(ProcessIndex process, SimTime clock) {
+  if (processes->levelEpoch[process] != epochAt(clock)) return 0;
+  return processes->level[process];
+}
+
+// Time slice for a process at its current level.
+SimTime MLFQQueue::getQuantum(ProcessIndex process, SimTime clock) {
+  SimTime quantum = baseQuantum;
+  for (int l = getLevel(process, clock); l > 0 && quantum < fromSeconds(1e9); l--) {   // Stop before fixed point ticks overflow
+    quantum += quantum;
+  }
+  return quantum;
+}
+
+// Moves a process that used up its time slice down one level.
+void MLFQQueue::demote(ProcessIndex process, SimTime clock) {
+  int level = getLevel(process, clock);
+  processes->level[process] = level + 1 < numLevels ? level + 1 : level;
+  processes->levelEpoch[process] = epochAt(clock);
+}
+
+void MLFQQueue::insert(ProcessIndex process, SimTime clock) {
+  long long now = epochAt(clock);
+  if (now != epoch) boost(now);
+
+  int level = getLevel(process, clock);
+  processes->level[process] = level;
+  processes->levelEpoch[process] = now;
+  processes->next[process] = NO_PROCESS;
+  if (heads[level] == NO_PROCESS) {
+    heads[level] = process;
+  }
+  else {
+    processes->next[tails[level]] = process;
+  }
+  tails[level] = process;
+  nonEmptyLevels |= uint64_t(1) << level;
+  size++;
+}
+
+// Removes and returns the first process of the highest non-empty level.
+ProcessIndex MLFQQueue::dequeue(SimTime clock) {
+  if (size == 0) {
+    throw runtime_error("Error: Attempted to remove process from empty Ready Queue.");
+  }
+  long long now = epochAt(clock);
+  if (now != epoch) boost(now);
+
+  int level = __builtin_ctzll(nonEmptyLevels);
+  ProcessIndex p = heads[level];
+  heads[level] = processes->next[p];
+  if (heads[level] == NO_PROCESS) {
+    tails[level] = NO_PROCESS;
+    nonEmptyLevels &= ~(uint64_t(1) << level);
+  }
+  processes->level[p] = level;
+  processes->levelEpoch[p] = now;
+  size--;
+  return p;
+}
+
+int MLFQQueue::getSize() {
+  return size;
+}
@@ -0,0 +1,52 @@
+#ifndef MLFQQUEUE_H
+#define MLFQQUEUE_H
+
+#include "ProcessTable.h"
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Ready Queue for MLFQ, stored as one FIFO list per priority level.
+// Level 0 is the highest priority. A process at level l runs for at most
+//   baseQuantum * 2^l before it is demoted one level, and every process
+//   (waiting or running) is boosted back to level 0 once per boost period.
+// A bitmap of non-empty levels finds the highest non-empty level with one
+//   count-trailing-zeros. Boosts are applied lazily: the lists are spliced
+//   onto level 0 (O(levels)) at the first operation of a new boost epoch,
+//   and a process's stored level only counts if it was set in the current
+//   epoch, so running processes never have to be visited.
+class MLFQQueue {
+  private:
+    static const int MAX_LEVELS = 64;
+
+    ProcessTable *processes;
+    int numLevels;
+    SimTime baseQuantum;
+    double boostPeriod;     // Seconds, 0 = never boost
+
+    vector<ProcessIndex> heads;
+    vector<ProcessIndex> tails;
+    uint64_t nonEmptyLevels;  // Bit l set if level l holds a process
+    long long epoch;          // Boost epoch the lists are up to date with
+    int size;
+
+    long long epochAt(SimTime);
+    void boost(long long);
+
+  public:
+    MLFQQueue(ProcessTable *);
+
+    void setParameters(int, SimTime, double);
+
+    int getLevel(ProcessIndex, SimTime);
+    SimTime getQuantum(ProcessIndex, SimTime);
+    void demote(ProcessIndex, SimTime);
+
+    void insert(ProcessIndex, SimTime);
+    ProcessIndex dequeue(SimTime);
+    int getSize();
+};
+
+#endif // MLFQQUEUE_H
@@ -0,0 +1,76 @@
+#include "ProcessClasses.h"
+#include "../generators/Distribution.h"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+// Index of the '/' ending the service distribution in the distribution
+//   specs of a class entry, or npos if there is no arrival distribution.
+//   Empirical file names may contain '/' too, so the arrival distribution
+//   starts at the first '/' followed by a distribution name and then ':' or
+//   the end of the entry.
+static size_t findArrivalSeparator(const string &specs) {
+  for (size_t slash = specs.find('/'); slash != string::npos; slash = specs.find('/', slash + 1)) {
+    size_t nameEnd = specs.find(':', slash + 1);
+    string name = specs.substr(slash + 1, nameEnd == string::npos ? string::npos : nameEnd - slash - 1);
+    if (Distribution::isName(name)) return slash;
+  }
+  return string::npos;
+}
+
+vector<ProcessClass> parseProcessClasses(const string &spec, const ProcessClass &defaults) {
+  if (spec.empty()) {
+    return {defaults};
+  }
+
+  vector<ProcessClass> classes;
+  stringstream specStream(spec);
+  string entry;
+  while (getline(specStream, entry, ';')) {
+    // rate/mean/priority, then the distribution specs, which may hold '/'
+    vector<string> fields;
+    size_t start = 0;
+    for (int i = 0; i < 3 && start != string::npos; i++) {
+      size_t end = entry.find('/', start);
+      fields.push_back(entry.substr(start, end == string::npos ? string::npos : end - start));
+      start = end == string::npos ? string::npos : end + 1;
+    }
+    if (fields.size() < 3) {
+      throw runtime_error("Invalid process class " + entry + ", expected rate/mean/priority.");
+    }
+    if (start != string::npos && start < entry.size()) {
+      string specs = entry.substr(start);
+      size_t separator = findArrivalSeparator(specs);
+      fields.push_back(specs.substr(0, separator));
+      if (separator != string::npos) fields.push_back(specs.substr(separator + 1));
+    }
+
+    ProcessClass c = defaults;
+    try {
+      size_t rateEnd, meanEnd, priorityEnd;
+      c.arrivalLambda = stof(fields[0], &rateEnd);
+      c.serviceTimeAvg = stof(fields[1], &meanEnd);
+      c.priority = stoi(fields[2], &priorityEnd);
+      if (rateEnd != fields[0].size() || meanEnd != fields[1].size() || priorityEnd != fields[2].size()) {
+        throw invalid_argument(entry);
+      }
+    }
+    catch (const logic_error &) {
+      throw runtime_error("Invalid process class " + entry + ", expected rate/mean/priority.");
+    }
+    if (!(c.arrivalLambda > 0) || isinf(c.arrivalLambda) || !(c.serviceTimeAvg > 0) || isinf(c.serviceTimeAvg)) {
+      throw runtime_error("Process class " + entry + " needs a positive arrival rate and mean service time.");
+    }
+    if (c.priority < 0 || c.priority >= NUM_PRIORITIES) {
+      throw runtime_error("Process class " + entry + " needs a priority from 0 to " + to_string(NUM_PRIORITIES - 1) + ".");
+    }
+    if (fields.size() > 3) c.serviceDistribution = fields[3];
+    if (fields.size() > 4) c.arrivalDistribution = fields[4];
+    classes.push_back(c);
+  }
+
+  if (classes.empty() || classes.size() > MAX_PROCESS_CLASSES) {
+    throw runtime_error("Between 1 and " + to_string(MAX_PROCESS_CLASSES) + " process classes are supported.");
+  }
+  return classes;
+}
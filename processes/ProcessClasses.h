@@ -0,0 +1,31 @@
+#ifndef PROCESSCLASSES_H
+#define PROCESSCLASSES_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const int NUM_PRIORITIES = 64;          // Priorities run from 0 (highest) to NUM_PRIORITIES - 1
+const int MAX_PROCESS_CLASSES = 1024;   // Also bounds the class ids read from a trace
+
+// ====================================================================
+// A workload class: its own stream of arrivals, with their own rate and
+//   service times, all at one priority.
+struct ProcessClass {
+  float arrivalLambda;
+  float serviceTimeAvg;
+  string arrivalDistribution;     // Distribution specs, see generators/Distribution.h
+  string serviceDistribution;
+  int priority;
+};
+
+// Parses a list of classes separated by semicolons, each
+//   rate/mean/priority, optionally followed by /service distribution and
+//   /arrival distribution, e.g. "8/0.1/0;0.5/4/1/hyperexp:10". Class ids
+//   are given in order from 0. Left out distributions come from defaults,
+//   and an empty spec is just defaults at priority 0.
+// Throws runtime_error if the spec is invalid.
+vector<ProcessClass> parseProcessClasses(const string &spec, const ProcessClass &defaults);
+
+#endif // PROCESSCLASSES_H
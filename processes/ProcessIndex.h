@@ -0,0 +1,11 @@
+#ifndef PROCESSINDEX_H
+#define PROCESSINDEX_H
+
+#include <cstdint>
+
+// Index of a process in the ProcessTable.
+// Only valid until the process is destroyed, after which it is reused.
+typedef uint32_t ProcessIndex;
+const ProcessIndex NO_PROCESS = UINT32_MAX;
+
+#endif // PROCESSINDEX_H
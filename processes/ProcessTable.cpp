@@ -0,0 +1,64 @@
+#include "ProcessTable.h"
+
+ProcessTable::ProcessTable() {
+  freeList = NO_PROCESS;
+  numInUse = 0;
+  highWaterMark = 0;
+}
+
+// Fills a free slot (or a new one at the end) with a process that has not
+//   run yet, and returns its index.
+ProcessIndex ProcessTable::create(int processID, SimTime serviceT, SimTime arrivalT) {
+  ProcessIndex p;
+  if (freeList != NO_PROCESS) {
+    p = freeList;
+    freeList = next[p];
+  }
+  else {
+    p = id.size();
+    id.push_back(0);
+    serviceTime.push_back(SimTime());
+    timeLeft.push_back(SimTime());
+    arrivalTime.push_back(SimTime());
+    lastRunTime.push_back(SimTime());
+    cpuTime.push_back(SimTime());
+    started.push_back(false);
+    CPUindex.push_back(-1);
+    RQindex.push_back(-1);
+    affinity.push_back(ALL_CPU_CLASSES);
+    processClass.push_back(0);
+    priority.push_back(0);
+    level.push_back(0);
+    levelEpoch.push_back(0);
+    departureEvent.push_back(NO_EVENT);
+    next.push_back(NO_PROCESS);
+  }
+
+  id[p] = processID;
+  serviceTime[p] = serviceT;
+  timeLeft[p] = serviceT;
+  arrivalTime[p] = arrivalT;
+  lastRunTime[p] = SimTime();
+  cpuTime[p] = SimTime();
+  started[p] = false;
+  CPUindex[p] = -1;
+  RQindex[p] = -1;
+  affinity[p] = ALL_CPU_CLASSES;
+  processClass[p] = 0;
+  priority[p] = 0;
+  level[p] = 0;
+  levelEpoch[p] = 0;
+  departureEvent[p] = NO_EVENT;
+  next[p] = NO_PROCESS;
+
+  numInUse++;
+  if (numInUse > highWaterMark) highWaterMark = numInUse;
+  return p;
+}
+
+// Returns a process's slot to the free list.
+void ProcessTable::destroy(ProcessIndex p) {
+  next[p] = freeList;
+  freeList = p;
+  numInUse--;
+}
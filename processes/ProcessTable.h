@@ -0,0 +1,59 @@
+#ifndef PROCESSTABLE_H
+#define PROCESSTABLE_H
+
+#include "ProcessIndex.h"
+#include "AffinityMask.h"
+#include "../events/EventHandle.h"
+#include "../SimTime.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Every process in the system, stored as parallel arrays addressed by
+//   ProcessIndex instead of as individual objects.
+// The fields the schedulers touch are each kept contiguous, and queues,
+//   CPUs and events link processes through 32-bit indices rather than
+//   pointers. Indices stay valid while the arrays grow. Destroyed
+//   processes go on a free list threaded through next and their slots are
+//   reused by the next create(), so once the table has grown to the peak
+//   number of live processes it makes no further heap allocations.
+class ProcessTable {
+  public:
+    vector<int> id;
+    vector<SimTime> serviceTime;
+    vector<SimTime> timeLeft;
+    vector<SimTime> arrivalTime;
+    vector<SimTime> lastRunTime;
+    vector<SimTime> cpuTime;              // Time spent running, up to lastRunTime
+    vector<bool> started;                 // Has been put on a CPU
+    vector<int> CPUindex;
+    vector<int> RQindex;
+    vector<AffinityMask> affinity;        // CPU classes the process may run on
+    vector<int> processClass;             // Workload class (see ProcessClasses.h)
+    vector<int> priority;                 // Priority scheduler level, 0 is the highest
+    vector<int> level;                    // MLFQ priority level, 0 is the highest
+    vector<long long> levelEpoch;         // MLFQ boost epoch in which level was set
+    vector<EventHandle> departureEvent;   // Pending departure or end of time slice, NO_EVENT if not running
+    vector<ProcessIndex> next;            // Next process in an FCFS Ready Queue or the free list
+
+  private:
+    ProcessIndex freeList;
+    int numInUse;
+    int highWaterMark;
+
+  public:
+    ProcessTable();
+
+    ProcessTable(const ProcessTable &) = delete;
+    ProcessTable &operator=(const ProcessTable &) = delete;
+
+    ProcessIndex create(int, SimTime, SimTime);
+    void destroy(ProcessIndex);
+
+    int getNumInUse() { return numInUse; }
+    int getHighWaterMark() { return highWaterMark; }
+    int getCapacity() { return id.size(); }
+};
+
+#endif // PROCESSTABLE_H
@@ -1,130 +1,170 @@
 #include "ReadyQueueList.h"
-#include <stdexcept>
 
-struct ReadyQueueList::ReadyQueue {
-  Process *head;
-  Process *tail;
-  int size;
+ReadyQueueList::ReadyQueueList(ProcessTable *processes, int numOfQueues, const vector<int> &queueClasses) {
+  this->processes = processes;
+  sizes.assign(numOfQueues, 0);
+  this->queueClasses = queueClasses.empty() ? vector<int>(numOfQueues, 0) : queueClasses;
 
-  ReadyQueue() {
-    head = nullptr;
-    tail = nullptr;
-    size = 0;
+  int numClasses = 0;
+  for (int c : this->queueClasses) {
+    numClasses = max(numClasses, c + 1);
   }
-};
+  classIndexes.resize(numClasses);
 
-ReadyQueueList::ReadyQueueList(int schedulerType, int numOfQueues) {
-  this->schedulerType = schedulerType;
+  // Every queue starts in the bucket for length 0, with nothing to drain
+  for (ClassIndex &index : classIndexes) {
+    index.bucketHeads.assign(1, -1);
+    index.longestSize = 0;
+    index.shortestSize = 0;
+  }
+  prevInBucket.assign(numOfQueues, -1);
+  nextInBucket.assign(numOfQueues, -1);
+  for (int i = numOfQueues - 1; i >= 0; i--) {
+    linkToBucket(i);
+  }
+
+  drainTimes.assign(numOfQueues, SimTime());
   for (int i = 0; i < numOfQueues; i++) {
-    RQs.push_back(new ReadyQueue());
+    vector<int> &heap = classIndexes[this->queueClasses[i]].drainHeap;
+    drainHeapPositions.push_back(heap.size());
+    heap.push_back(i);
+  }
+}
+
+// Processes in the Ready Queues are owned by the simulation's process table.
+ReadyQueueList::~ReadyQueueList() {}
+
+void ReadyQueueList::unlinkFromBucket(int queueIndex) {
+  int prev = prevInBucket[queueIndex];
+  int next = nextInBucket[queueIndex];
+  if (prev == -1) {
+    classIndexes[queueClasses[queueIndex]].bucketHeads[sizes[queueIndex]] = next;
+  }
+  else {
+    nextInBucket[prev] = next;
+  }
+  if (next != -1) {
+    prevInBucket[next] = prev;
   }
 }
 
-ReadyQueueList::~ReadyQueueList() {
-  for (int i = 0; i < RQs.size(); i++) {
-    Process *p = RQs[i]->head;
-    while (p) {
-      RQs[i]->head = RQs[i]->head->next;
-      delete p;
-      p = RQs[i]->head;
-    }
+void ReadyQueueList::linkToBucket(int queueIndex) {
+  vector<int> &bucketHeads = classIndexes[queueClasses[queueIndex]].bucketHeads;
+  int size = sizes[queueIndex];
+  if (size == bucketHeads.size()) {
+    bucketHeads.push_back(-1);
   }
-  for (int i = 0; i < RQs.size(); i++) {
-      delete RQs[i];
+  int head = bucketHeads[size];
+  prevInBucket[queueIndex] = -1;
+  nextInBucket[queueIndex] = head;
+  if (head != -1) {
+    prevInBucket[head] = queueIndex;
   }
+  bucketHeads[size] = queueIndex;
 }
 
-void ReadyQueueList::setSchedulerType(int st) {
-  schedulerType = st;
+// Adds delta (+1 or -1) to a Ready Queue's length and moves it to the
+//   matching bucket.
+void ReadyQueueList::changeRQSize(int queueIndex, int delta) {
+  int oldSize = sizes[queueIndex];
+  unlinkFromBucket(queueIndex);
+  sizes[queueIndex] += delta;
+  linkToBucket(queueIndex);
+
+  ClassIndex &index = classIndexes[queueClasses[queueIndex]];
+  int newSize = sizes[queueIndex];
+  if (newSize > index.longestSize || (oldSize == index.longestSize && index.bucketHeads[oldSize] == -1)) {
+    index.longestSize = newSize;
+  }
+  if (newSize < index.shortestSize || (oldSize == index.shortestSize && index.bucketHeads[oldSize] == -1)) {
+    index.shortestSize = newSize;
+  }
 }
 
 int ReadyQueueList::getNumRQs() {
-  return RQs.size();
+  return sizes.size();
 }
 
 int ReadyQueueList::getRQSize(int queueIndex) {
-  return RQs[queueIndex]->size;
+  return sizes[queueIndex];
 }
 
 bool ReadyQueueList::isRQEmpty(int queueIndex) {
-  return RQs[queueIndex]->size == 0;
+  return sizes[queueIndex] == 0;
+}
+
+// Index of a Ready Queue with the most processes waiting, among the
+//   queues of the CPU classes in mask.
+int ReadyQueueList::getLongestRQ(AffinityMask mask) {
+  int best = -1;
+  for (int c = 0; c < classIndexes.size(); c++) {
+    if (!(mask >> c & 1)) continue;
+    if (best == -1 || classIndexes[c].longestSize > classIndexes[best].longestSize) best = c;
+  }
+  return classIndexes[best].bucketHeads[classIndexes[best].longestSize];
+}
+
+// Index of a Ready Queue with the fewest processes waiting, among the
+//   queues of the CPU classes in mask.
+int ReadyQueueList::getShortestRQ(AffinityMask mask) {
+  int best = -1;
+  for (int c = 0; c < classIndexes.size(); c++) {
+    if (!(mask >> c & 1)) continue;
+    if (best == -1 || classIndexes[c].shortestSize < classIndexes[best].shortestSize) best = c;
+  }
+  return classIndexes[best].bucketHeads[classIndexes[best].shortestSize];
+}
+
+// Moves a Ready Queue's drain time and restores the heap order.
+void ReadyQueueList::setDrainTime(int queueIndex, SimTime time) {
+  vector<int> &drainHeap = classIndexes[queueClasses[queueIndex]].drainHeap;
+  drainTimes[queueIndex] = time;
+  int pos = drainHeapPositions[queueIndex];
+  int n = drainHeap.size();
+
+  while (pos > 0 && drainTimes[drainHeap[(pos - 1) / 2]] > time) {     // Sift up
+    int parent = (pos - 1) / 2;
+    drainHeap[pos] = drainHeap[parent];
+    drainHeapPositions[drainHeap[pos]] = pos;
+    pos = parent;
+  }
+  while (2 * pos + 1 < n) {                                             // Sift down
+    int child = 2 * pos + 1;
+    if (child + 1 < n && drainTimes[drainHeap[child + 1]] < drainTimes[drainHeap[child]]) child++;
+    if (!(drainTimes[drainHeap[child]] < time)) break;
+    drainHeap[pos] = drainHeap[child];
+    drainHeapPositions[drainHeap[pos]] = pos;
+    pos = child;
+  }
+  drainHeap[pos] = queueIndex;
+  drainHeapPositions[queueIndex] = pos;
+}
+
+// Adds the time a Ready Queue's CPU needs for more service, starting no
+//   earlier than clock.
+void ReadyQueueList::addWork(int queueIndex, SimTime clock, SimTime work) {
+  SimTime start = drainTimes[queueIndex] > clock ? drainTimes[queueIndex] : clock;
+  setDrainTime(queueIndex, start + work);
+}
+
+// Takes away the time of a process that left the Ready Queue without running.
+void ReadyQueueList::removeWork(int queueIndex, SimTime work) {
+  setDrainTime(queueIndex, drainTimes[queueIndex] - work);
 }
 
-// Insert process into the target Ready Queue based on FCFS, SJF, SRTF, or HRRN
-void ReadyQueueList::insertProcessRQ(Process *process, int queueIndex) {
-  process->RQindex = queueIndex;
-  ReadyQueue *RQ = RQs[queueIndex];
-
-  if (schedulerType == 1 || schedulerType == 2) {      // SJF & SRTF
-    if (!RQ->head || process->timeLeft < RQ->head->timeLeft) {
-      process->next = RQ->head;
-      RQ->head = process;
-    }
-    else {
-      Process *p = RQ->head;
-      while (p->next && p->next->timeLeft < process->timeLeft) {
-          p = p->next;
-      }
-      process->next = p->next;
-      p->next = process;
-    }
-  }
-  else {                                               // FCFS or HRRN or default
-    if (RQs[queueIndex]->head == nullptr) {
-      RQ->head = process;
-      RQ->tail = process;
-    } 
-    else {
-      RQ->tail->next = process;
-      RQ->tail = process;
-    }
-  }
-  RQ->size++;
+// Records that a Ready Queue's CPU has gone idle, with no work left.
+void ReadyQueueList::clearWork(int queueIndex, SimTime clock) {
+  setDrainTime(queueIndex, clock);
 }
 
-Process* ReadyQueueList::dequeueProcessRQ(float clock, int queueIndex) {
-  if (isRQEmpty(queueIndex)) {
-      throw runtime_error("Error: Attempted to remove process from empty Ready Queue.");
-  }
-  if (schedulerType == 3) {                      // HRRN, dequeue process with highest RR
-    float maxRR = 0.0;
-    int maxRRID = -1;
-
-    Process *p = RQs[queueIndex]->head;
-    while (p) {                                  // Find process with highest RR
-      float RR = 1 + (clock - p->arrivalTime) / p->serviceTime;
-      if (RR > maxRR) {
-        maxRR = RR;
-        maxRRID = p->id;
-      }
-      p = p->next;
-    }
-
-    p = RQs[queueIndex]->head;  // Remove process with highest RR from target Ready Queue
-    Process *prev = nullptr;
-    while (p) {
-      if (p->id == maxRRID) {
-        if (prev) {
-          prev->next = p->next;
-        }
-        else {
-          RQs[queueIndex]->head = p->next;
-        }
-        if (p == RQs[queueIndex]->tail) {
-          RQs[queueIndex]->tail = prev;
-        }
-        RQs[queueIndex]->size--;
-        break;
-      }
-      prev = p;
-      p = p->next;
-    }
-    return p;
-  }
-  else {                        // Not HRRN, dequeue next process from target Ready Queue
-    Process *p = RQs[queueIndex]->head;
-    RQs[queueIndex]->head = RQs[queueIndex]->head->next;
-    RQs[queueIndex]->size--;
-    return p;
+// Index of a Ready Queue whose CPU has the least work left, among the
+//   queues of the CPU classes in mask.
+int ReadyQueueList::getLeastWorkRQ(AffinityMask mask) {
+  int best = -1;
+  for (int c = 0; c < classIndexes.size(); c++) {
+    if (!(mask >> c & 1)) continue;
+    int top = classIndexes[c].drainHeap[0];
+    if (best == -1 || drainTimes[top] < drainTimes[best]) best = top;
   }
+  return best;
 }
@@ -1,31 +1,106 @@
 #ifndef READYQUEUELIST_H
 #define READYQUEUELIST_H
 
-#include "Process.h"
+#include "ProcessTable.h"
+#include "SchedulerPolicies.h"
+#include <stdexcept>
 #include <vector>
 
 using namespace std;
 
 // ====================================================================
 // Ready Queue List structure
+// Only tracks the queue sizes, which is all statistics and output need.
+//   The queues themselves live in a PolicyReadyQueueList.
 class ReadyQueueList {
-  private:  
-    int schedulerType;
-    struct ReadyQueue;
-    vector<ReadyQueue *> RQs;
-  
+  private:
+    // Ready Queues bucketed by length, so the longest and shortest can be
+    //   found in constant time. Lengths only ever change by one.
+    // Time each Ready Queue's CPU would run out of work if nothing else
+    //   arrived, in an indexed min-heap. The work left, max(0, drain time -
+    //   clock), shrinks as the CPU runs, but the drain time only changes
+    //   when work is added, moved or the CPU goes idle.
+    // Both are kept per CPU class, so lookups restricted to an affinity mask
+    //   cost one lookup per class.
+    struct ClassIndex {
+      vector<int> bucketHeads;    // First queue of each length, -1 if none
+      int longestSize;
+      int shortestSize;
+      vector<int> drainHeap;      // Queue indices, earliest drain time first
+    };
+    vector<ClassIndex> classIndexes;
+    vector<int> queueClasses;         // CPU class of each Ready Queue
+    vector<int> prevInBucket;
+    vector<int> nextInBucket;
+    vector<SimTime> drainTimes;
+    vector<int> drainHeapPositions;   // Position of each queue in its class's drainHeap
+
+    void unlinkFromBucket(int);
+    void linkToBucket(int);
+    void setDrainTime(int, SimTime);
+
+  protected:
+    ProcessTable *processes;
+    vector<int> sizes;
+
+    void changeRQSize(int, int);
+
   public:
-    ReadyQueueList(int, int = 1);
-    ~ReadyQueueList();
+    // queueClasses gives the CPU class of each queue, all class 0 if empty
+    ReadyQueueList(ProcessTable *, int = 1, const vector<int> & = {});
+    virtual ~ReadyQueueList();
 
-    void setSchedulerType(int);
-  
     int getNumRQs();
     int getRQSize(int = 0);
     bool isRQEmpty(int = 0);
-  
-    void insertProcessRQ(Process *, int = 0);
-    Process* dequeueProcessRQ(float, int = 0);
+
+    int getLongestRQ(AffinityMask = ALL_CPU_CLASSES);
+    int getShortestRQ(AffinityMask = ALL_CPU_CLASSES);
+
+    void addWork(int, SimTime, SimTime);
+    void removeWork(int, SimTime);
+    void clearWork(int, SimTime);
+    int getLeastWorkRQ(AffinityMask = ALL_CPU_CLASSES);
+  };
+
+
+// ====================================================================
+// Ready Queues ordered by one scheduler policy (see SchedulerPolicies.h).
+// Defined in the header so the simulation's event loop can inline the
+//   policy's calls.
+template <class Policy>
+class PolicyReadyQueueList : public ReadyQueueList {
+  private:
+    vector<Policy> RQs;
+
+  public:
+    PolicyReadyQueueList(ProcessTable *processes, const SchedulerParameters &params, int numOfQueues = 1,
+                         const vector<int> &queueClasses = {})
+      : ReadyQueueList(processes, numOfQueues, queueClasses) {
+      RQs.reserve(numOfQueues);
+      for (int i = 0; i < numOfQueues; i++) {
+        RQs.emplace_back(processes, params);
+      }
+    }
+
+    void insertProcessRQ(SimTime clock, ProcessIndex process, int queueIndex = 0) {
+      processes->RQindex[process] = queueIndex;
+      RQs[queueIndex].insert(clock, process);
+      changeRQSize(queueIndex, 1);
+    }
+
+    ProcessIndex dequeueProcessRQ(SimTime clock, int queueIndex = 0) {
+      if (isRQEmpty(queueIndex)) {
+        throw runtime_error("Error: Attempted to remove process from empty Ready Queue.");
+      }
+      changeRQSize(queueIndex, -1);
+      return RQs[queueIndex].dequeue(clock);
+    }
+
+    // Policy of a Ready Queue, for preemption and time slice decisions.
+    Policy &getPolicy(int queueIndex = 0) {
+      return RQs[queueIndex];
+    }
   };
 
-#endif // READYQUEUELIST_H
\ No newline at end of file
+#endif // READYQUEUELIST_H
@@ -0,0 +1,303 @@
+#ifndef SCHEDULERPOLICIES_H
+#define SCHEDULERPOLICIES_H
+
+#include "ProcessTable.h"
+#include "HRRNQueue.h"
+#include "MLFQQueue.h"
+#include "ProcessClasses.h"
+#include "../config.h"
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Scheduler policies, one Ready Queue each.
+// The simulation's event loop is instantiated once per policy (see
+//   Simulation::runWith), so every call below is resolved at compile time
+//   and can be inlined, and policies without arrival preemption or
+//   quanta compile those checks away. Each policy provides:
+//     Policy(ProcessTable *, const SchedulerParameters &)
+//     void insert(SimTime clock, ProcessIndex)
+//     ProcessIndex dequeue(SimTime clock)       // Queue is not empty
+//     bool preemptsOnArrival(SimTime clock, ProcessIndex arriving,
+//                            ProcessIndex running, SimTime runningTimeLeft)
+//     bool preemptsOnTimeLeft()     // Preemption compares time left rather
+//                                   //   than priority, for live updates
+//     SimTime getQuantum(SimTime clock, ProcessIndex)   // SimTime() = none
+//     void quantumExpired(SimTime clock, ProcessIndex)
+
+// Settings shared by every policy, filled in from the SimulationConfig.
+struct SchedulerParameters {
+  int schedulerType = 0;
+  SimTime quantum = SimTime();         // Time slice for every scheduler but MLFQ, SimTime() = none
+  int mlfqLevels = MLFQ_LEVELS;
+  SimTime mlfqQuantum = fromSeconds(MLFQ_BASE_QUANTUM);
+  double mlfqBoostPeriod = MLFQ_BOOST_PERIOD;
+};
+
+
+// ====================================================================
+// FCFS: a linked list through the process table's next field.
+class FCFSPolicy {
+  private:
+    ProcessTable *processes;
+    SimTime quantum;
+    ProcessIndex head;
+    ProcessIndex tail;
+
+  public:
+    FCFSPolicy(ProcessTable *processes, const SchedulerParameters &params) {
+      this->processes = processes;
+      quantum = params.quantum;
+      head = NO_PROCESS;
+      tail = NO_PROCESS;
+    }
+
+    void insert(SimTime, ProcessIndex process) {
+      processes->next[process] = NO_PROCESS;
+      if (head == NO_PROCESS) {
+        head = process;
+      }
+      else {
+        processes->next[tail] = process;
+      }
+      tail = process;
+    }
+
+    ProcessIndex dequeue(SimTime) {
+      ProcessIndex p = head;
+      head = processes->next[p];
+      return p;
+    }
+
+    bool preemptsOnArrival(SimTime, ProcessIndex, ProcessIndex, SimTime) { return false; }
+    bool preemptsOnTimeLeft() { return false; }
+    SimTime getQuantum(SimTime, ProcessIndex) { return quantum; }
+    void quantumExpired(SimTime, ProcessIndex) {}
+};
+
+// RR: FCFS with a time quantum, so expired processes go to the back.
+class RoundRobinPolicy : public FCFSPolicy {
+  public:
+    RoundRobinPolicy(ProcessTable *processes, const SchedulerParameters &params) : FCFSPolicy(processes, params) {}
+};
+
+
+// ====================================================================
+// SJF: an array-backed binary heap keyed on timeLeft, equal values FIFO.
+class SJFPolicy {
+  private:
+    struct HeapEntry {
+      SimTime timeLeft;
+      long long seq;      // Insertion order, keeps equal timeLeft values FIFO
+      ProcessIndex process;
+    };
+
+    // Heap ordering: true if a should be dequeued after b
+    static bool dequeuedAfter(const HeapEntry &a, const HeapEntry &b) {
+      return a.timeLeft > b.timeLeft || (a.timeLeft == b.timeLeft && a.seq > b.seq);
+    }
+
+    SimTime quantum;
+    vector<HeapEntry> heap;
+    long long nextSeq;
+
+  protected:
+    ProcessTable *processes;
+
+  public:
+    SJFPolicy(ProcessTable *processes, const SchedulerParameters &params) {
+      this->processes = processes;
+      quantum = params.quantum;
+      nextSeq = 0;
+    }
+
+    void insert(SimTime, ProcessIndex process) {
+      heap.push_back({processes->timeLeft[process], nextSeq++, process});
+      push_heap(heap.begin(), heap.end(), dequeuedAfter);
+    }
+
+    ProcessIndex dequeue(SimTime) {
+      pop_heap(heap.begin(), heap.end(), dequeuedAfter);
+      ProcessIndex p = heap.back().process;
+      heap.pop_back();
+      return p;
+    }
+
+    bool preemptsOnArrival(SimTime, ProcessIndex, ProcessIndex, SimTime) { return false; }
+    bool preemptsOnTimeLeft() { return false; }
+    SimTime getQuantum(SimTime, ProcessIndex) { return quantum; }
+    void quantumExpired(SimTime, ProcessIndex) {}
+};
+
+// SRTF: SJF that preempts the running process when a shorter one arrives.
+class SRTFPolicy : public SJFPolicy {
+  public:
+    SRTFPolicy(ProcessTable *processes, const SchedulerParameters &params) : SJFPolicy(processes, params) {}
+
+    bool preemptsOnArrival(SimTime, ProcessIndex arriving, ProcessIndex, SimTime runningTimeLeft) {
+      return processes->serviceTime[arriving] < runningTimeLeft;
+    }
+    bool preemptsOnTimeLeft() { return true; }
+};
+
+
+// ====================================================================
+// HRRN: a kinetic tournament tree (see HRRNQueue.h).
+class HRRNPolicy {
+  private:
+    HRRNQueue queue;
+    SimTime quantum;
+
+  public:
+    HRRNPolicy(ProcessTable *processes, const SchedulerParameters &params) : queue(processes) {
+      quantum = params.quantum;
+    }
+
+    void insert(SimTime, ProcessIndex process) { queue.insert(process); }
+    ProcessIndex dequeue(SimTime clock) { return queue.dequeue(clock); }
+
+    bool preemptsOnArrival(SimTime, ProcessIndex, ProcessIndex, SimTime) { return false; }
+    bool preemptsOnTimeLeft() { return false; }
+    SimTime getQuantum(SimTime, ProcessIndex) { return quantum; }
+    void quantumExpired(SimTime, ProcessIndex) {}
+};
+
+
+// ====================================================================
+// MLFQ: FIFO lists per priority level (see MLFQQueue.h). Arrivals enter at
+//   the top level and preempt a running process from a lower level.
+class MLFQPolicy {
+  private:
+    MLFQQueue queue;
+
+  public:
+    MLFQPolicy(ProcessTable *processes, const SchedulerParameters &params) : queue(processes) {
+      queue.setParameters(params.mlfqLevels, params.mlfqQuantum, params.mlfqBoostPeriod);
+    }
+
+    void insert(SimTime clock, ProcessIndex process) { queue.insert(process, clock); }
+    ProcessIndex dequeue(SimTime clock) { return queue.dequeue(clock); }
+
+    bool preemptsOnArrival(SimTime clock, ProcessIndex, ProcessIndex running, SimTime) {
+      return queue.getLevel(running, clock) > 0;
+    }
+    bool preemptsOnTimeLeft() { return false; }
+    SimTime getQuantum(SimTime clock, ProcessIndex process) { return queue.getQuantum(process, clock); }
+    void quantumExpired(SimTime clock, ProcessIndex process) { queue.demote(process, clock); }
+};
+
+
+// ====================================================================
+// Priority: FIFO lists per priority through the process table's next
+//   field, with a bitmap of non-empty priorities so the highest is one
+//   count-trailing-zeros away. Arrivals preempt a running process of lower
+//   priority. Priorities come from the process's workload class.
+class PriorityPolicy {
+  private:
+    ProcessTable *processes;
+    SimTime quantum;
+    ProcessIndex heads[NUM_PRIORITIES];
+    ProcessIndex tails[NUM_PRIORITIES];
+    uint64_t nonEmptyPriorities;    // Bit p set if priority p holds a process
+
+  public:
+    PriorityPolicy(ProcessTable *processes, const SchedulerParameters &params) {
+      this->processes = processes;
+      quantum = params.quantum;
+      fill(heads, heads + NUM_PRIORITIES, NO_PROCESS);
+      fill(tails, tails + NUM_PRIORITIES, NO_PROCESS);
+      nonEmptyPriorities = 0;
+    }
+
+    void insert(SimTime, ProcessIndex process) {
+      int p = processes->priority[process];
+      processes->next[process] = NO_PROCESS;
+      if (heads[p] == NO_PROCESS) {
+        heads[p] = process;
+        nonEmptyPriorities |= uint64_t(1) << p;
+      }
+      else {
+        processes->next[tails[p]] = process;
+      }
+      tails[p] = process;
+    }
+
+    ProcessIndex dequeue(SimTime) {
+      int p = __builtin_ctzll(nonEmptyPriorities);
+      ProcessIndex process = heads[p];
+      heads[p] = processes->next[process];
+      if (heads[p] == NO_PROCESS) {
+        nonEmptyPriorities &= ~(uint64_t(1) << p);
+      }
+      return process;
+    }
+
+    bool preemptsOnArrival(SimTime, ProcessIndex arriving, ProcessIndex running, SimTime) {
+      return processes->priority[arriving] < processes->priority[running];
+    }
+    bool preemptsOnTimeLeft() { return false; }
+    SimTime getQuantum(SimTime, ProcessIndex) { return quantum; }
+    void quantumExpired(SimTime, ProcessIndex) {}
+};
+
+
+// ====================================================================
+// Forwards every operation to one of the policies above, picked on every
+//   call by the scheduler type. This is how scheduling worked before the
+//   event loop was specialized per policy, and is only kept to measure the
+//   difference (compile with -DRUNTIME_SCHEDULER_DISPATCH, see
+//   simulation/schedulerBenchmark).
+class RuntimePolicy {
+  private:
+    int schedulerType;
+    FCFSPolicy fcfs;
+    SRTFPolicy srtf;    // Also used for SJF, which never preempts
+    HRRNPolicy hrrn;
+    MLFQPolicy mlfq;
+    PriorityPolicy priority;
+
+  public:
+    RuntimePolicy(ProcessTable *processes, const SchedulerParameters &params)
+      : fcfs(processes, params), srtf(processes, params), hrrn(processes, params), mlfq(processes, params),
+        priority(processes, params) {
+      schedulerType = params.schedulerType;
+    }
+
+    void insert(SimTime clock, ProcessIndex process) {
+      if (schedulerType == 1 || schedulerType == 2) srtf.insert(clock, process);
+      else if (schedulerType == 3) hrrn.insert(clock, process);
+      else if (schedulerType == 5) mlfq.insert(clock, process);
+      else if (schedulerType == 6) priority.insert(clock, process);
+      else fcfs.insert(clock, process);
+    }
+
+    ProcessIndex dequeue(SimTime clock) {
+      if (schedulerType == 3) return hrrn.dequeue(clock);
+      else if (schedulerType == 5) return mlfq.dequeue(clock);
+      else if (schedulerType == 6) return priority.dequeue(clock);
+      else if (schedulerType == 1 || schedulerType == 2) return srtf.dequeue(clock);
+      else return fcfs.dequeue(clock);
+    }
+
+    bool preemptsOnArrival(SimTime clock, ProcessIndex arriving, ProcessIndex running, SimTime runningTimeLeft) {
+      if (schedulerType == 2) return srtf.preemptsOnArrival(clock, arriving, running, runningTimeLeft);
+      else if (schedulerType == 5) return mlfq.preemptsOnArrival(clock, arriving, running, runningTimeLeft);
+      else if (schedulerType == 6) return priority.preemptsOnArrival(clock, arriving, running, runningTimeLeft);
+      return false;
+    }
+
+    bool preemptsOnTimeLeft() { return schedulerType == 2; }
+
+    SimTime getQuantum(SimTime clock, ProcessIndex process) {
+      if (schedulerType == 5) return mlfq.getQuantum(clock, process);
+      return fcfs.getQuantum(clock, process);
+    }
+
+    void quantumExpired(SimTime clock, ProcessIndex process) {
+      if (schedulerType == 5) mlfq.quantumExpired(clock, process);
+    }
+};
+
+#endif // SCHEDULERPOLICIES_H
@@ -0,0 +1,165 @@
+#include "../../processes/HRRNQueue.h"
+#include "../../processes/ProcessTable.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Linear scan over the waiting processes in insertion order, picking the
+//   highest response ratio with ties going to the earliest inserted. This
+//   is what HRRNQueue's tournament tree has to reproduce exactly.
+class ScanQueue {
+  private:
+    ProcessTable *processes;
+    vector<ProcessIndex> waiting;
+
+  public:
+    ScanQueue(ProcessTable *processes) {
+      this->processes = processes;
+    }
+
+    void insert(ProcessIndex process) {
+      waiting.push_back(process);
+    }
+
+    ProcessIndex dequeue(SimTime clock) {
+      double now = toSeconds(clock);
+      int best = 0;
+      double bestRR = 0;
+      for (int i = 0; i < waiting.size(); i++) {
+        ProcessIndex p = waiting[i];
+        double RR = 1 + (now - toSeconds(processes->arrivalTime[p])) / toSeconds(processes->serviceTime[p]);
+        if (i == 0 || RR > bestRR) {
+          bestRR = RR;
+          best = i;
+        }
+      }
+      ProcessIndex p = waiting[best];
+      waiting.erase(waiting.begin() + best);
+      return p;
+    }
+};
+
+// ====================================================================
+// Replays a random sequence of inserts and dequeues against both queues and
+//   checks that every dequeue picks the same process. The clock moves
+//   forward by exponential steps from startTime. Service times are drawn
+//   from serviceTimes if given (to force exact ties), otherwise
+//   exponentially with mean 1, and then scaled by 1 + jitter * U(0, 1) (to
+//   force near ties). The queue drifts around targetSize.
+// Returns the number of mismatched dequeues.
+long long runCheck(string name, int numOps, int targetSize, double startTime, vector<double> serviceTimes, double jitter) {
+  mt19937 rng(12345);
+  exponential_distribution<double> step(targetSize);
+  exponential_distribution<double> service(1.0);
+  uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  ProcessTable processes;
+  HRRNQueue tree(&processes);
+  ScanQueue scan(&processes);
+
+  double clock = startTime;
+  int size = 0;
+  long long mismatches = 0;
+  for (int i = 0; i < numOps; i++) {
+    clock += step(rng);
+    bool insert = size == 0 || uniform(rng) < (size < targetSize ? 0.6 : 0.4);
+    if (insert) {
+      double serviceTime = serviceTimes.empty() ? service(rng) : serviceTimes[rng() % serviceTimes.size()];
+      serviceTime *= 1 + jitter * uniform(rng);
+      ProcessIndex p = processes.create(i, fromSeconds(serviceTime), fromSeconds(clock));
+      tree.insert(p);
+      scan.insert(p);
+      size++;
+    }
+    else {
+      ProcessIndex fromTree = tree.dequeue(fromSeconds(clock));
+      ProcessIndex fromScan = scan.dequeue(fromSeconds(clock));
+      if (fromTree != fromScan) {
+        if (mismatches == 0) {
+          cout << "Error: " << name << " dequeued process " << processes.id[fromTree] << " instead of "
+               << processes.id[fromScan] << " at time " << clock << "." << endl;
+        }
+        mismatches++;
+      }
+      processes.destroy(fromScan);
+      size--;
+    }
+  }
+  return mismatches;
+}
+
+// Time per dequeue with a steady queue of the given size, where every
+//   dequeue is followed by an insert. Returns dequeues per second.
+template <class Queue>
+double runHold(int queueSize, int numOps) {
+  mt19937 rng(12345);
+  exponential_distribution<double> step(queueSize);
+  exponential_distribution<double> service(1.0);
+
+  ProcessTable processes;
+  Queue q(&processes);
+  double clock = 0;
+  for (int i = 0; i < queueSize; i++) {
+    clock += step(rng);
+    q.insert(processes.create(i, fromSeconds(service(rng)), fromSeconds(clock)));
+  }
+
+  auto start = chrono::steady_clock::now();
+  for (int i = 0; i < numOps; i++) {
+    clock += step(rng);
+    processes.destroy(q.dequeue(fromSeconds(clock)));
+    q.insert(processes.create(queueSize + i, fromSeconds(service(rng)), fromSeconds(clock)));
+  }
+  auto end = chrono::steady_clock::now();
+
+  return numOps / chrono::duration<double>(end - start).count();
+}
+
+int main() {
+  const int numOps = 1000000;
+
+  struct Case {
+    string name;
+    int targetSize;
+    double startTime;
+    vector<double> serviceTimes;
+    double jitter;
+  };
+  const Case cases[] = {
+    {"random", 100, 0, {}, 0},
+    {"small queue", 3, 0, {}, 0},
+    {"large queue", 3000, 0, {}, 0},
+    {"exact ties", 100, 0, {0.5, 1, 2}, 0},
+    {"near ties", 100, 0, {1}, 1e-9},
+    {"late clock", 100, 1e7, {}, 0},
+    {"late near ties", 100, 1e7, {1}, 1e-6},
+  };
+
+  cout << "Checking the tournament tree against a linear scan..." << endl;
+  long long failures = 0;
+  for (const Case &c : cases) {
+    int ops = c.targetSize > 1000 ? numOps / 10 : numOps;    // The scan is slow on large queues
+    long long mismatches = runCheck(c.name, ops, c.targetSize, c.startTime, c.serviceTimes, c.jitter);
+    cout << setw(16) << c.name << ": " << (mismatches == 0 ? "ok" : to_string(mismatches) + " mismatched dequeues") << endl;
+    failures += mismatches;
+  }
+  if (failures > 0) {
+    return 1;
+  }
+
+  cout << endl << setw(8) << "Queue" << setw(16) << "scan deq/s" << setw(16) << "tree deq/s" << endl;
+  for (int queueSize = 16; queueSize <= 16384; queueSize *= 4) {
+    int scanOps = min(numOps, max(10000, 100000000 / queueSize));
+    cout << setw(8) << queueSize << fixed << setprecision(0)
+         << setw(16) << runHold<ScanQueue>(queueSize, scanOps)
+         << setw(16) << runHold<HRRNQueue>(queueSize, numOps) << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,612 @@
+#include "Simulation.h"
+#include "../events/ListEventQueue.h"
+#include "../events/HeapEventQueue.h"
+#include "../events/CalendarEventQueue.h"
+#include "../dispatchers/RandomDispatcher.h"
+#include "../dispatchers/RoundRobinDispatcher.h"
+#include "../dispatchers/ShortestQueueDispatcher.h"
+#include "../dispatchers/PowerOfDDispatcher.h"
+#include "../dispatchers/LeastWorkDispatcher.h"
+#include "../generators/GeneratedArrivalSource.h"
+#include "../traces/TraceReader.h"
+#include "../config.h"
+#include <ctime>
+#include <stdexcept>
+
+using namespace std;
+
+
+// ====================================================================
+// Validates the configuration and sets up the system with no processes.
+Simulation::Simulation(const SimulationConfig &config, Output *out) {
+  if (config.arrivalLambda <= 0 || config.serviceTimeAvg <= 0 || (config.schedulerType < 0 || 6 < config.schedulerType) 
+      || config.quantum < 0 || (config.schedulerType == 4 && config.quantum == 0)
+      || config.numCPUs <= 0 || !(config.rqSetup == 1 || config.rqSetup == 2) 
+      || config.pushInterval < 0 || config.migrationCost < 0
+      || (config.dispatcher < 0 || 4 < config.dispatcher) || config.dispatchChoices < 1
+      || (config.eventQueueType < 0 || 3 < config.eventQueueType) || config.histogramBins < 0
+      || config.quantileAccuracy < 0 || config.quantileAccuracy >= 1) {
+    throw runtime_error("Invalid simulation arguments.");
+  }
+  this->config = config;
+  this->out = out;
+  clock = SimTime();
+  nextProcessID = 0;
+  numEvents = 0;
+  hasRun = false;
+
+  int numRQs = config.rqSetup == 2 ? 1 : config.numCPUs;
+  bool perCPU = numRQs > 1;
+  pushInterval = perCPU ? fromSeconds(config.pushInterval) : SimTime();
+  pullMigration = perCPU && config.pullMigration;
+  migrationCost = fromSeconds(config.migrationCost);
+
+  unsigned long long seed = config.seed ? config.seed : time(0);
+
+  // Split one seed into non-overlapping streams for arrivals, service times
+  //   and CPU picks
+  Xoshiro256 arrivalStream(seed);
+  Xoshiro256 serviceStream = arrivalStream;
+  serviceStream.jump();
+  Xoshiro256 cpuStream = serviceStream;
+  cpuStream.jump();
+
+  randGen = new RandomGenerator(cpuStream);
+
+  // Workload classes. A trace gives each process's class itself, so only
+  //   the priorities are used.
+  ProcessClass defaultClass = {config.arrivalLambda, config.serviceTimeAvg, config.arrivalDistribution,
+                               config.serviceDistribution, 0};
+  vector<ProcessClass> processClasses = parseProcessClasses(config.processClasses, defaultClass);
+  for (const ProcessClass &c : processClasses) {
+    classPriorities.push_back(c.priority);
+  }
+
+  if (config.traceFile.empty()) {
+    // Class 0 uses the streams above, and every further class two more,
+    //   one long jump further along each
+    vector<TimeGenerator *> timeGens;
+    for (const ProcessClass &c : processClasses) {
+      timeGens.push_back(new TimeGenerator(c.arrivalDistribution, c.arrivalLambda, c.serviceDistribution, c.serviceTimeAvg,
+                                           arrivalStream, serviceStream));
+      arrivalStream.longJump();
+      serviceStream.longJump();
+    }
+    arrivals = new GeneratedArrivalSource(timeGens);
+  }
+  else {
+    arrivals = new TraceReader(config.traceFile);
+  }
+  arrivalsExhausted = false;
+  endChecker = new EndChecker(config.endCondition, config.N, config.timeLimit);
+  processes = new ProcessTable();
+  EventQueueType eventQueueType = config.eventQueueType;
+  if (eventQueueType == AUTO_QUEUE) {
+    eventQueueType = config.numCPUs <= AUTO_QUEUE_LIST_MAX_CPUS ? LIST_QUEUE : HEAP_QUEUE;
+  }
+  switch (eventQueueType) {
+    case LIST_QUEUE:     eventQ = new ListEventQueue(); break;
+    case HEAP_QUEUE:     eventQ = new HeapEventQueue(); break;
+    case CALENDAR_QUEUE: eventQ = new CalendarEventQueue(); break;
+    case AUTO_QUEUE:     break;   // Resolved above
+  }
+  cpuList = new CPUList(processes, parseCPUClasses(config.cpuClasses, config.numCPUs));
+  preemptionPending = vector<bool>(config.numCPUs, false);
+  affinityMix = new AffinityMix(config.affinities, cpuList->getNumClasses());
+  if (affinityMix->restrictsAny() && !perCPU) {
+    throw runtime_error("Invalid simulation arguments: process affinities need per-CPU Ready Queues.");
+  }
+  affinityStream = new Xoshiro256(cpuStream);
+  affinityStream->jump();
+
+  // Each per-CPU Ready Queue belongs to its CPU's class
+  vector<int> queueClasses;
+  if (perCPU) {
+    for (int i = 0; i < config.numCPUs; i++) {
+      queueClasses.push_back(cpuList->getCPUClass(i));
+    }
+  }
+
+  SchedulerParameters params;
+  params.schedulerType = config.schedulerType;
+  params.quantum = fromSeconds(config.quantum);
+  params.mlfqLevels = config.mlfqLevels;
+  params.mlfqQuantum = fromSeconds(config.mlfqQuantum);
+  params.mlfqBoostPeriod = config.mlfqBoostPeriod;
+#ifdef RUNTIME_SCHEDULER_DISPATCH
+  usePolicy<RuntimePolicy>(params, numRQs, queueClasses);
+#else
+  switch (config.schedulerType) {
+    case 0: usePolicy<FCFSPolicy>(params, numRQs, queueClasses); break;
+    case 1: usePolicy<SJFPolicy>(params, numRQs, queueClasses); break;
+    case 2: usePolicy<SRTFPolicy>(params, numRQs, queueClasses); break;
+    case 3: usePolicy<HRRNPolicy>(params, numRQs, queueClasses); break;
+    case 4: usePolicy<RoundRobinPolicy>(params, numRQs, queueClasses); break;
+    case 5: usePolicy<MLFQPolicy>(params, numRQs, queueClasses); break;
+    case 6: usePolicy<PriorityPolicy>(params, numRQs, queueClasses); break;
+  }
+#endif
+  stats = new StatisticsUnit(processes, cpuList, RQList, config.histogramBins, classPriorities.size(), config.quantileAccuracy);
+
+  dispatcher = nullptr;
+  if (perCPU) {
+    switch (config.dispatcher) {
+      case RANDOM_DISPATCH:         dispatcher = new RandomDispatcher(randGen, cpuList); break;
+      case ROUND_ROBIN_DISPATCH:    dispatcher = new RoundRobinDispatcher(cpuList); break;
+      case SHORTEST_QUEUE_DISPATCH: dispatcher = new ShortestQueueDispatcher(randGen, cpuList, RQList); break;
+      case POWER_OF_D_DISPATCH:     dispatcher = new PowerOfDDispatcher(randGen, cpuList, RQList, config.dispatchChoices); break;
+      case LEAST_WORK_DISPATCH:     dispatcher = new LeastWorkDispatcher(RQList); break;
+    }
+  }
+}
+
+Simulation::~Simulation() {
+  delete arrivals;
+  delete randGen;
+  delete affinityStream;
+  delete affinityMix;
+  delete endChecker;
+  delete stats;
+  delete dispatcher;
+  delete cpuList;
+  delete RQList;
+  delete eventQ;
+  delete processes;     // Also frees processes still waiting, running or about to arrive
+}
+
+
+// ====================================================================
+// Creates the Ready Queues for a scheduler policy and selects the event
+//   loop instantiated for it.
+template <class Policy>
+void Simulation::usePolicy(const SchedulerParameters &params, int numRQs, const vector<int> &queueClasses) {
+  RQList = new PolicyReadyQueueList<Policy>(processes, params, numRQs, queueClasses);
+  runLoop = &Simulation::runWith<Policy>;
+}
+
+
+// ====================================================================
+// Adds a new process of a workload class to the process table with the
+//   next process ID.
+// Affinities are only drawn if some process is restricted, so runs without
+//   them use the same random numbers as before they existed.
+ProcessIndex Simulation::createProcess(SimTime serviceTime, SimTime arrivalTime, int processClass) {
+  ProcessIndex process = processes->create(nextProcessID++, serviceTime, arrivalTime);
+  processes->processClass[process] = processClass;
+  processes->priority[process] = classPriorities[processClass];
+  if (affinityMix->restrictsAny()) {
+    processes->affinity[process] = affinityMix->sample(*affinityStream);
+  }
+  return process;
+}
+
+
+// ====================================================================
+// Inserts new event for an arrival or departure to Event Queue.
+EventHandle Simulation::scheduleEvent(EventType type, SimTime t, ProcessIndex process) {
+  return eventQ->push(type, t, process);
+}
+
+
+// ====================================================================
+// Pulls the next process from the arrival source and schedules its arrival.
+// Only one arrival is pending at a time, so a trace is read lazily.
+// Trace classes beyond the configured ones run at priority 0.
+void Simulation::scheduleNextArrival() {
+  SimTime arrivalTime, serviceTime;
+  uint32_t processClass;
+  if (!arrivals->next(arrivalTime, serviceTime, processClass)) {
+    arrivalsExhausted = true;
+    return;
+  }
+  if (processClass >= classPriorities.size()) {
+    if (processClass >= MAX_PROCESS_CLASSES) {
+      throw runtime_error("Error: Process class " + to_string(processClass) + " is above the limit of "
+                          + to_string(MAX_PROCESS_CLASSES) + " classes.");
+    }
+    classPriorities.resize(processClass + 1, 0);
+    stats->setNumProcessClasses(classPriorities.size());
+  }
+  scheduleEvent(ARRIVAL, arrivalTime, createProcess(serviceTime, arrivalTime, processClass));
+}
+
+
+// ====================================================================
+// Puts a process on a CPU and schedules the end of its run.
+template <class Policy>
+void Simulation::dispatch(PolicyReadyQueueList<Policy> *RQList, ProcessIndex process, int CPUindex) {
+  if (!processes->started[process]) {
+    processes->started[process] = true;
+    stats->processStarted(process, clock);
+  }
+  cpuList->assignProcessToCPU(clock, process, CPUindex);
+  scheduleRunEnd(RQList, process, processes->timeLeft[process]);
+}
+
+
+// ====================================================================
+// Schedules a running process's departure, or the end of its time slice
+//   if it needs longer than the quantum (MLFQ: its level's quantum) to finish.
+// remaining is service time, which takes longer or shorter on the CPU
+//   depending on its speed. Quanta are in wall time.
+// The pending event's handle is kept so a preemption can cancel it.
+template <class Policy>
+void Simulation::scheduleRunEnd(PolicyReadyQueueList<Policy> *RQList, ProcessIndex process, SimTime remaining) {
+  SimTime runTime = cpuList->workToTime(processes->CPUindex[process], remaining);
+  SimTime slice = RQList->getPolicy(processes->RQindex[process]).getQuantum(clock, process);
+  if (slice > SimTime() && slice < runTime) {
+    processes->departureEvent[process] = scheduleEvent(QUANTUM_EXPIRY, clock + slice, process);
+  }
+  else {
+    processes->departureEvent[process] = scheduleEvent(DEPARTURE, clock + runTime, process);
+  }
+}
+
+
+// ====================================================================
+// Takes the next process out of one Ready Queue for another CPU. It needs
+//   the migration cost on top of its remaining time once it gets there.
+// The caller inserts it into the other Ready Queue or dispatches it.
+// Both Ready Queues must be in the same CPU class, so the process's
+//   affinity still holds.
+template <class Policy>
+ProcessIndex Simulation::migrateProcess(PolicyReadyQueueList<Policy> *RQList, int fromRQindex, int toRQindex) {
+  ProcessIndex process = RQList->dequeueProcessRQ(clock, fromRQindex);
+  stats->sampleRQueue(clock, fromRQindex);
+  stats->logMigration(fromRQindex, toRQindex);
+  RQList->removeWork(fromRQindex, cpuList->workToTime(fromRQindex, processes->timeLeft[process]));
+  processes->timeLeft[process] += migrationCost;
+  processes->RQindex[process] = toRQindex;
+  RQList->addWork(toRQindex, clock, cpuList->workToTime(toRQindex, processes->timeLeft[process]));
+  return process;
+}
+
+
+// ====================================================================
+// Schedules the preemption of the process on a busy CPU if the policy puts
+//   process, just added to the CPU's Ready Queue, ahead of it. At most one
+//   preemption is pending per CPU, since it runs whichever process the
+//   Ready Queue puts first. Returns true if one was scheduled.
+template <class Policy>
+bool Simulation::checkPreemption(PolicyReadyQueueList<Policy> *RQList, ProcessIndex process, int RQindex, int CPUindex) {
+  if (preemptionPending[CPUindex]) return false;
+
+  ProcessIndex currentProcess = cpuList->getProcessOnCPU(CPUindex);
+  SimTime timeLeft = processes->timeLeft[currentProcess] - cpuList->timeToWork(CPUindex, clock - processes->lastRunTime[currentProcess]);
+  if (!RQList->getPolicy(RQindex).preemptsOnArrival(clock, process, currentProcess, timeLeft)) return false;
+
+  preemptionPending[CPUindex] = true;
+  scheduleEvent(PREEMPTION, clock, currentProcess);
+  return true;
+}
+
+
+// ====================================================================
+// Takes the process off a CPU, crediting the CPU with the time it ran.
+ProcessIndex Simulation::stopProcess(int CPUindex) {
+  ProcessIndex process = cpuList->getProcessOnCPU(CPUindex);
+  stats->logRun(CPUindex, clock - processes->lastRunTime[process]);
+  processes->cpuTime[process] += clock - processes->lastRunTime[process];
+  return cpuList->removeProcessFromCPU(clock, CPUindex);
+}
+
+
+// ====================================================================
+// Handle an arrival event (process arrives to system)
+// Schedules the next arrival.
+// Assigns e's process to the CPU (if idle), or inserts it into the Ready Queue.
+template <class Policy>
+void Simulation::handleArrival(PolicyReadyQueueList<Policy> *RQList, Event *e) {
+  scheduleNextArrival();
+
+  int CPUindex = 0;
+  int RQindex = 0;
+  if (RQList->getNumRQs() == 1) {   // Single Ready Queue setup
+    int numIdle = cpuList->getNumIdleCPUs();
+    if (numIdle > 0) {
+      CPUindex = cpuList->getIdleCPU(randGen->getRandomIndex(numIdle));  // Pick random idle CPU
+    }
+  }
+  else {                            // Per-CPU Ready Queue setup
+    CPUindex = dispatcher->pickCPU(processes->affinity[e->process]);
+    RQindex = CPUindex;
+  }
+
+  ProcessIndex process = e->process;
+  RQList->addWork(RQindex, clock, cpuList->workToTime(CPUindex, processes->serviceTime[process]));
+  Output::LiveUpdateType eventType;
+  ProcessIndex currentProcess = NO_PROCESS;
+  
+  if (cpuList->isCPUIdle(CPUindex)) {            // Target CPU is idle
+    processes->RQindex[process] = RQindex;
+    dispatch(RQList, process, CPUindex);
+    eventType = Output::ARRIVAL_TO_CPU;
+  }
+  else {     // Target CPU is busy, add to its Ready Queue, but check for preemption
+    RQList->insertProcessRQ(clock, process, RQindex);
+    stats->sampleRQueue(clock, RQindex);
+
+    currentProcess = cpuList->getProcessOnCPU(CPUindex);
+    if (checkPreemption(RQList, process, RQindex, CPUindex)) {  // SRTF, MLFQ or Priority, preempt process on CPU
+      processes->CPUindex[process] = CPUindex;
+      eventType = RQList->getPolicy(RQindex).preemptsOnTimeLeft() ? Output::ARRIVAL_PREEMPT_SRTF : Output::ARRIVAL_PREEMPT_PRIORITY;
+    }
+    else {
+      eventType = Output::ARRIVAL_TO_RQ;
+    }
+  }
+
+  if (PRINT_LIVE_UPDATES && out) out->printLiveUpdate(clock, eventType, processes, process, RQList, currentProcess);
+}
+
+
+// ====================================================================
+// Handle a departure event (process is finished on CPU)
+// Returns e's process to the process table's free list.
+// Next process is pulled from the Ready Queue, or the CPU goes idle if empty.
+template <class Policy>
+void Simulation::handleDeparture(PolicyReadyQueueList<Policy> *RQList, Event *e) {
+  ProcessIndex process = e->process;
+  stats->processDone(process, clock);
+
+  int CPUindex = processes->CPUindex[process];
+  if (cpuList->getProcessOnCPU(CPUindex) != process) {
+    throw runtime_error("Error: Process on CPU does not match departing process.");
+  }
+
+  int RQindex = 0;
+  if (RQList->getNumRQs() != 1) {             // Get correct Ready Queue index
+    RQindex = CPUindex;
+  }
+
+  Output::LiveUpdateType eventType;
+  ProcessIndex nextProcess = NO_PROCESS;
+
+  stopProcess(CPUindex);
+
+  if (RQList->isRQEmpty(RQindex)) {           // Target Ready Queue is empty
+    int longest = pullMigration ? RQList->getLongestRQ(cpuList->getClassMask(cpuList->getCPUClass(CPUindex))) : RQindex;
+    if (!RQList->isRQEmpty(longest)) {        // Pull a process from the longest Ready Queue of the CPU's class
+      nextProcess = migrateProcess(RQList, longest, RQindex);
+      dispatch(RQList, nextProcess, CPUindex);
+      eventType = Output::DEPARTURE_PULL_MIGRATION;
+    }
+    else {
+      RQList->clearWork(RQindex, clock);
+      eventType = Output::DEPARTURE_CPU_IDLE;
+    }
+  }
+  else {                                      // Target Ready Queue is not empty, move next process to target CPU
+    nextProcess = RQList->dequeueProcessRQ(clock, RQindex);
+    dispatch(RQList, nextProcess, CPUindex);
+    stats->sampleRQueue(clock, RQindex);
+    eventType = Output::DEPARTURE_NEXT_PROCESS;
+  }
+
+  if (PRINT_LIVE_UPDATES && out) out->printLiveUpdate(clock, eventType, processes, process, RQList, nextProcess);
+
+  processes->destroy(process);
+}
+
+
+// ====================================================================
+// Handle a preemption event (process is interrupted while running on CPU)
+// Puts e's process back into the Ready Queue and puts next process on CPU.
+// Puts the process back on the CPU if the Ready Queue is empty. 
+template <class Policy>
+void Simulation::handlePreemption(PolicyReadyQueueList<Policy> *RQList, Event *e) {
+  int CPUindex = processes->CPUindex[e->process];
+  if (e->process != cpuList->getProcessOnCPU(CPUindex)) {
+    throw runtime_error("Error: Process on CPU does not match preempted process.");
+  }
+  preemptionPending[CPUindex] = false;
+
+  int RQindex = 0;
+  if (RQList->getNumRQs() != 1) {
+    RQindex = CPUindex;
+  }
+
+  ProcessIndex process = stopProcess(CPUindex);    // Put process into Ready Queue
+  eventQ->remove(processes->departureEvent[process]);     // Cancel its departure through its handle
+  processes->departureEvent[process] = NO_EVENT;
+  RQList->insertProcessRQ(clock, process, RQindex);
+
+  ProcessIndex nextProcess = RQList->dequeueProcessRQ(clock, RQindex);      // Move next process in RQ to CPU
+  dispatch(RQList, nextProcess, CPUindex);
+
+  bool arrivalPreempt = processes->arrivalTime[nextProcess] == clock;
+  if (PRINT_LIVE_UPDATES && out && !arrivalPreempt) out->printLiveUpdate(clock, Output::PREEMPTION_INTERVAL, processes, process, RQList, nextProcess);
+}
+
+
+// ====================================================================
+// Handle a quantum expiry event (process has used up its time slice)
+// Puts e's process back into the Ready Queue (at the back for RR, one level
+//   down for MLFQ) and puts the next process on CPU. If the Ready Queue is empty the process keeps
+//   the CPU and just starts a new time slice.
+template <class Policy>
+void Simulation::handleQuantumExpiry(PolicyReadyQueueList<Policy> *RQList, Event *e) {
+  ProcessIndex process = e->process;
+  int CPUindex = processes->CPUindex[process];
+  if (process != cpuList->getProcessOnCPU(CPUindex)) {
+    throw runtime_error("Error: Process on CPU does not match expiring process.");
+  }
+  processes->departureEvent[process] = NO_EVENT;   // e was its pending event
+  RQList->getPolicy(processes->RQindex[process]).quantumExpired(clock, process);   // MLFQ: down one level
+
+  int RQindex = 0;
+  if (RQList->getNumRQs() != 1) {
+    RQindex = CPUindex;
+  }
+
+  ProcessIndex nextProcess = process;
+  if (RQList->isRQEmpty(RQindex)) {
+    SimTime remaining = processes->timeLeft[process] - cpuList->timeToWork(CPUindex, clock - processes->lastRunTime[process]);
+    scheduleRunEnd(RQList, process, remaining);
+  }
+  else {
+    stopProcess(CPUindex);
+    RQList->insertProcessRQ(clock, process, RQindex);
+    nextProcess = RQList->dequeueProcessRQ(clock, RQindex);
+    dispatch(RQList, nextProcess, CPUindex);
+  }
+
+  if (PRINT_LIVE_UPDATES && out) out->printLiveUpdate(clock, Output::PREEMPTION_INTERVAL, processes, process, RQList, nextProcess);
+}
+
+
+// ====================================================================
+// Handle a push migration event (periodic rebalancing of per-CPU Ready Queues)
+// Within each CPU class, moves processes from the longest Ready Queue to
+//   idle CPUs first, then to the shortest Ready Queue while they differ by
+//   two or more. A process pushed to a busy CPU's Ready Queue preempts its
+//   process just like an arrival would.
+// Schedules the next push migration unless a trace has run out and every
+//   process is done, which would otherwise keep the run going forever.
+template <class Policy>
+void Simulation::handlePushMigration(PolicyReadyQueueList<Policy> *RQList, Event *) {
+  for (int c = 0; c < cpuList->getNumClasses(); c++) {
+    AffinityMask classMask = cpuList->getClassMask(c);
+    while (true) {
+      int from = RQList->getLongestRQ(classMask);
+      if (RQList->isRQEmpty(from)) break;
+
+      if (cpuList->getNumIdleCPUs(classMask) > 0) {
+        int CPUindex = cpuList->getIdleCPU(classMask, 0);     // Its Ready Queue is empty
+        ProcessIndex process = migrateProcess(RQList, from, CPUindex);
+        dispatch(RQList, process, CPUindex);
+        if (PRINT_LIVE_UPDATES && out) out->printLiveUpdate(clock, Output::PUSH_MIGRATION_TO_CPU, processes, process, RQList);
+        continue;
+      }
+
+      int to = RQList->getShortestRQ(classMask);
+      if (RQList->getRQSize(from) - RQList->getRQSize(to) < 2) break;
+      ProcessIndex process = migrateProcess(RQList, from, to);
+      RQList->insertProcessRQ(clock, process, to);
+      stats->sampleRQueue(clock, to);
+      checkPreemption(RQList, process, to, to);
+      if (PRINT_LIVE_UPDATES && out) out->printLiveUpdate(clock, Output::PUSH_MIGRATION_TO_RQ, processes, process, RQList);
+    }
+  }
+
+  if (!arrivalsExhausted || processes->getNumInUse() > 0) {
+    scheduleEvent(PUSH_MIGRATION, clock + pushInterval, NO_PROCESS);
+  }
+}
+
+
+// ====================================================================
+// Runs the simulation until the end condition is met.
+SimulationMetrics Simulation::run() {
+  if (hasRun) {
+    throw runtime_error("Error: Simulation has already been run.");
+  }
+  hasRun = true;
+  return (this->*runLoop)();
+}
+
+
+// ====================================================================
+// The event loop, with every Ready Queue operation resolved to Policy.
+template <class Policy>
+SimulationMetrics Simulation::runWith() {
+  PolicyReadyQueueList<Policy> *RQList = static_cast<PolicyReadyQueueList<Policy> *>(this->RQList);
+
+  scheduleNextArrival();   // First process
+  if (pushInterval > SimTime()) {
+    scheduleEvent(PUSH_MIGRATION, clock + pushInterval, NO_PROCESS);
+  }
+
+  while (!endChecker->checkEnd()) {
+    if (eventQ->isEmpty()) {
+      if (arrivalsExhausted) break;     // Trace finished and every process is done
+      throw runtime_error("Error: Event queue is empty.");
+    }
+    Event event = eventQ->popMin();
+    clock = event.time;
+    numEvents++;
+
+    switch (event.type) {
+      case ARRIVAL: 
+        handleArrival(RQList, &event);
+        endChecker->logArrival(clock);
+        break;
+
+      case DEPARTURE:
+        handleDeparture(RQList, &event);
+        endChecker->logDeparture(clock);
+        break;
+
+      case PREEMPTION:
+        handlePreemption(RQList, &event);
+        break;
+
+      case QUANTUM_EXPIRY:
+        handleQuantumExpiry(RQList, &event);
+        break;
+
+      case PUSH_MIGRATION:
+        handlePushMigration(RQList, &event);
+        break;
+
+      default: 
+        throw runtime_error("Encountered invalid event type.");
+    }
+  }
+
+  return collectMetrics();
+}
+
+
+// ====================================================================
+// Calculates the metrics of the system at the current time.
+SimulationMetrics Simulation::collectMetrics() {
+  SimulationMetrics metrics;
+  metrics.endTime = toSeconds(clock);
+  metrics.avgTurnTime = stats->getAvgTurnTime();
+  metrics.throughput = stats->getThroughput(clock);
+
+  for (int i = 0; i < cpuList->getNumCPUs(); i++) {
+    metrics.utilization.push_back(stats->getUtilization(clock, i));
+  }
+  for (int i = 0; i < RQList->getNumRQs(); i++) {
+    metrics.avgProcessesInQ.push_back(stats->getAvgProcessesInQ(clock, i));
+    if (config.histogramBins > 0) {
+      metrics.RQLengthDistributions.push_back(stats->getRQLengthDistribution(clock, i));
+    }
+  }
+
+  if (pushInterval > SimTime() || pullMigration) {
+    for (int i = 0; i < RQList->getNumRQs(); i++) {
+      metrics.migrationsIn.push_back(stats->getMigrationsIn(i));
+      metrics.migrationsOut.push_back(stats->getMigrationsOut(i));
+    }
+  }
+
+  if (cpuList->getNumClasses() > 1) {
+    for (int c = 0; c < cpuList->getNumClasses(); c++) {
+      metrics.classAvgTurnTime.push_back(stats->getClassAvgTurnTime(c));
+      metrics.classThroughput.push_back(stats->getClassThroughput(clock, c));
+      metrics.classUtilization.push_back(stats->getClassUtilization(clock, c));
+    }
+  }
+
+  if (stats->getNumProcessClasses() > 1) {
+    for (int c = 0; c < stats->getNumProcessClasses(); c++) {
+      metrics.processClassNumDone.push_back(stats->getProcessClassNumDone(c));
+      metrics.processClassAvgTurnTime.push_back(stats->getProcessClassAvgTurnTime(c));
+      metrics.processClassAvgWaitTime.push_back(stats->getProcessClassAvgWaitTime(c));
+      metrics.processClassAvgSlowdown.push_back(stats->getProcessClassAvgSlowdown(c));
+      metrics.processClassThroughput.push_back(stats->getProcessClassThroughput(clock, c));
+    }
+  }
+
+  metrics.turnTimes = stats->getTurnTimeSketch();
+  metrics.waitTimes = stats->getWaitTimeSketch();
+  metrics.responseTimes = stats->getResponseTimeSketch();
+
+  metrics.peakProcesses = processes->getHighWaterMark();
+  metrics.peakEvents = eventQ->getPeakSize();
+  metrics.numEvents = numEvents;
+  return metrics;
+}
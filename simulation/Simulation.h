@@ -0,0 +1,91 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include "SimulationConfig.h"
+#include "SimulationMetrics.h"
+#include "../endChecker/endChecker.h"
+#include "../dispatchers/Dispatcher.h"
+#include "../events/EventQueue.h"
+#include "../generators/RandomGenerator.h"
+#include "../generators/ArrivalSource.h"
+#include "../output/output.h"
+#include "../processes/ProcessTable.h"
+#include "../processes/ReadyQueueList.h"
+#include "../processes/CPUList.h"
+#include "../processes/CPUClasses.h"
+#include "../processes/ProcessClasses.h"
+#include "../statistics/StatisticsUnit.h"
+
+// ====================================================================
+// A discrete time event simulation of a multi-CPU queuing system.
+// Owns all of the state of one run, so several simulations can exist in
+//   the same program. Each Simulation can be run once.
+// Processes either arrive at random or are replayed from a trace file. A
+//   replayed run also ends when the trace runs out and every process is done.
+class Simulation {
+  private:
+    SimulationConfig config;
+    SimTime clock;        // Current time tracker
+    int nextProcessID;
+    long long numEvents;  // Events handled so far
+    bool hasRun;
+
+    // Migration between per-CPU Ready Queues, off with a global Ready Queue
+    SimTime pushInterval;   // Time between push migrations, SimTime() = never
+    bool pullMigration;     // Idle CPUs take a process from the longest Ready Queue
+    SimTime migrationCost;  // Added to a migrated process's time left
+
+    EventQueue *eventQ;
+    ProcessTable *processes;
+
+    RandomGenerator *randGen;
+    ArrivalSource *arrivals;
+    bool arrivalsExhausted;
+    vector<int> classPriorities;    // Priority of each workload class
+    StatisticsUnit *stats;
+    EndChecker *endChecker;
+
+    CPUList *cpuList;
+    vector<bool> preemptionPending;   // Per CPU, a PREEMPTION event is scheduled for its process
+    ReadyQueueList *RQList;   // A PolicyReadyQueueList of the configured scheduler
+    Dispatcher *dispatcher;   // Routes arrivals with per-CPU Ready Queues, nullptr with a global one
+    AffinityMix *affinityMix; // CPU classes each new process may run on
+    Xoshiro256 *affinityStream;     // Own stream, so affinities don't shift the other draws
+    SimulationMetrics (Simulation::*runLoop)();   // runWith the same scheduler policy
+
+    Output *out;          // Used for live updates only, may be nullptr
+
+    ProcessIndex createProcess(SimTime, SimTime, int);
+    EventHandle scheduleEvent(EventType, SimTime, ProcessIndex);
+    void scheduleNextArrival();
+    ProcessIndex stopProcess(int);
+
+    // The event loop and everything that touches the Ready Queues is
+    //   instantiated once per scheduler policy, picked in the constructor.
+    template <class Policy> void usePolicy(const SchedulerParameters &, int, const vector<int> &);
+    template <class Policy> SimulationMetrics runWith();
+
+    template <class Policy> void dispatch(PolicyReadyQueueList<Policy> *, ProcessIndex, int);
+    template <class Policy> void scheduleRunEnd(PolicyReadyQueueList<Policy> *, ProcessIndex, SimTime);
+    template <class Policy> ProcessIndex migrateProcess(PolicyReadyQueueList<Policy> *, int, int);
+    template <class Policy> bool checkPreemption(PolicyReadyQueueList<Policy> *, ProcessIndex, int, int);
+
+    template <class Policy> void handleArrival(PolicyReadyQueueList<Policy> *, Event *);
+    template <class Policy> void handleDeparture(PolicyReadyQueueList<Policy> *, Event *);
+    template <class Policy> void handlePreemption(PolicyReadyQueueList<Policy> *, Event *);
+    template <class Policy> void handleQuantumExpiry(PolicyReadyQueueList<Policy> *, Event *);
+    template <class Policy> void handlePushMigration(PolicyReadyQueueList<Policy> *, Event *);
+
+    SimulationMetrics collectMetrics();
+
+  public:
+    Simulation(const SimulationConfig &, Output * = nullptr);
+    ~Simulation();
+
+    Simulation(const Simulation &) = delete;
+    Simulation &operator=(const Simulation &) = delete;
+
+    SimulationMetrics run();
+};
+
+#endif // SIMULATION_H
@@ -0,0 +1,46 @@
+#ifndef SIMULATIONCONFIG_H
+#define SIMULATIONCONFIG_H
+
+#include "../endChecker/EndCondition.h"
+#include "../events/EventQueueType.h"
+#include "../dispatchers/DispatcherType.h"
+#include "../config.h"
+#include <string>
+
+using namespace std;
+
+// ====================================================================
+// Parameters of a single simulation run.
+struct SimulationConfig {
+  float arrivalLambda = 1.0;           // Average arrival rate (processes per second)
+  float serviceTimeAvg = 1.0;          // Average service time (seconds)
+  string arrivalDistribution = ARRIVAL_DISTRIBUTION;  // Distribution specs, see generators/Distribution.h
+  string serviceDistribution = SERVICE_DISTRIBUTION;
+  string traceFile = TRACE_FILE;       // Replay arrivals from this trace instead (empty = generate)
+  string processClasses = PROCESS_CLASSES;  // Workload classes as rate/mean/priority, e.g. "8/0.1/0;0.5/4/1" (empty = one class from the above)
+  int schedulerType = DEFAULT_SCHEDULER;  // 0 = FCFS, 1 = SJF, 2 = SRTF, 3 = HRRN, 4 = RR, 5 = MLFQ, 6 = Priority
+  float quantum = DEFAULT_QUANTUM;     // Time slice before a running process is preempted (seconds, 0 = none, RR needs > 0)
+  int mlfqLevels = MLFQ_LEVELS;        // MLFQ only: number of priority levels (1 to 64)
+  float mlfqQuantum = MLFQ_BASE_QUANTUM;  // MLFQ only: time slice at the top level, doubling at each level down
+  float mlfqBoostPeriod = MLFQ_BOOST_PERIOD;  // MLFQ only: seconds between boosts to the top level (0 = never)
+  int rqSetup = DEFAULT_RQ_SETUP;      // 1 = per-CPU RQs, 2 = single global RQ
+  float pushInterval = PUSH_MIGRATION_INTERVAL;  // Per-CPU RQs only: seconds between push migrations (0 = never)
+  bool pullMigration = PULL_MIGRATION; // Per-CPU RQs only: CPUs with an empty Ready Queue take work from the longest one
+  float migrationCost = MIGRATION_COST;   // Extra service time (seconds) of a migrated process
+  DispatcherType dispatcher = DISPATCHER; // Per-CPU RQs only: how arrivals pick a CPU
+  int dispatchChoices = DISPATCH_CHOICES; // CPUs sampled by the power of d choices dispatcher
+  int numCPUs = DEFAULT_NUM_CPUS;
+  string cpuClasses = CPU_CLASSES;     // Counts and speeds of the CPUs, e.g. "4x2;12x1" (empty = all speed 1)
+  string affinities = PROCESS_AFFINITIES; // Per-CPU RQs only: mix of CPU classes processes may run on, e.g. "0.3:0;0.7:*" (empty = any)
+  EventQueueType eventQueueType = DEFAULT_EVENT_QUEUE;
+
+  EndCondition endCondition = DEFAULT_END_CONDITION;
+  int N = DEFAULT_N;                   // Used if the end condition is processes arrived/departed
+  float timeLimit = DEFAULT_TIME_LIMIT;   // Used if the end condition is a time limit
+
+  int histogramBins = RQ_LENGTH_HISTOGRAM_BINS;
+  float quantileAccuracy = QUANTILE_ACCURACY;   // Relative accuracy of the time percentiles (0 = off)
+  unsigned long long seed = RANDOM_SEED;  // 0 = seed from the current time
+};
+
+#endif // SIMULATIONCONFIG_H
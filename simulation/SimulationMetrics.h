@@ -0,0 +1,37 @@
+#ifndef SIMULATIONMETRICS_H
+#define SIMULATIONMETRICS_H
+
+#include "../statistics/QuantileSketch.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Results of a single simulation run.
+struct SimulationMetrics {
+  float endTime;                    // Simulated time when the end condition was met
+  float avgTurnTime;
+  float throughput;
+  vector<float> utilization;        // Per CPU
+  vector<float> avgProcessesInQ;    // Per Ready Queue
+  vector<vector<float>> RQLengthDistributions;  // Per Ready Queue, empty if histograms are off
+  vector<long long> migrationsIn;   // Per Ready Queue, empty unless per-CPU RQs migrate
+  vector<long long> migrationsOut;
+  vector<float> classAvgTurnTime;   // Per CPU class, empty unless there are several
+  vector<float> classThroughput;
+  vector<float> classUtilization;   // Average over the class's CPUs
+  vector<long long> processClassNumDone;  // Per workload class, empty unless there are several
+  vector<float> processClassAvgTurnTime;  // 0 for a class with no processes done
+  vector<float> processClassAvgWaitTime;
+  vector<float> processClassAvgSlowdown;
+  vector<float> processClassThroughput;
+  QuantileSketch turnTimes;         // Empty unless quantiles are on
+  QuantileSketch waitTimes;
+  QuantileSketch responseTimes;
+
+  int peakProcesses;                // Most processes allocated at once
+  int peakEvents;                   // Most events pending at once
+  long long numEvents;              // Events handled during the run
+};
+
+#endif // SIMULATIONMETRICS_H
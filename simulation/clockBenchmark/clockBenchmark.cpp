@@ -0,0 +1,73 @@
+#include "../Simulation.h"
+#include "../SimulationConfig.h"
+#include "../SimulationMetrics.h"
+#include "../../SimTime.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cmath>
+
+using namespace std;
+
+// Runs an M/M/1 queue (arrival rate 0.8, mean service time 1) up to
+//   increasing time limits with whichever SimTime this binary was built with,
+//   and compares the results with the analytic values: turnaround time
+//   1 / (mu - lambda) = 5, utilization rho = 0.8 and mean ready queue length
+//   rho^2 / (1 - rho) = 3.2.
+// Short horizons are dominated by sampling error. What matters is that the
+//   error keeps shrinking as the horizon grows instead of levelling off where
+//   the clock runs out of resolution.
+// Built twice by the makefile: clockBenchmark (double) and
+//   clockBenchmarkFixed (-DFIXED_POINT_TIME).
+int main() {
+  const double lambda = 0.8;
+  const double expectedTurnTime = 1.0 / (1.0 - lambda);
+  const double expectedQueue = lambda * lambda / (1.0 - lambda);
+
+#ifdef FIXED_POINT_TIME
+  cout << "SimTime: 64-bit fixed point, " << FixedTime::TICKS_PER_SECOND << " ticks per second" << endl;
+#else
+  cout << "SimTime: double" << endl;
+#endif
+
+  cout << setw(10) << "horizon" << setw(14) << "events/s" << setw(14) << "resolution"
+       << setw(14) << "turn err" << setw(14) << "util err" << setw(14) << "queue err" << endl;
+
+  for (double horizon = 1e3; horizon <= 1e7; horizon *= 10) {
+    SimulationConfig config;
+    config.arrivalLambda = lambda;
+    config.serviceTimeAvg = 1.0;
+    config.schedulerType = 0;
+    config.rqSetup = 2;
+    config.numCPUs = 1;
+    config.eventQueueType = HEAP_QUEUE;
+    config.endCondition = TIME_LIMIT;
+    config.timeLimit = horizon;
+    config.histogramBins = 0;
+    config.seed = 1;
+
+    auto start = chrono::steady_clock::now();
+    Simulation simulation(config);
+    SimulationMetrics m = simulation.run();
+    auto end = chrono::steady_clock::now();
+
+    double events = m.numEvents;
+    double seconds = chrono::duration<double>(end - start).count();
+
+    // Smallest step the clock can take at the end of the run
+#ifdef FIXED_POINT_TIME
+    double resolution = 1.0 / FixedTime::TICKS_PER_SECOND;
+#else
+    double resolution = nextafter(horizon, 2 * horizon) - horizon;
+#endif
+
+    cout << setw(10) << scientific << setprecision(0) << horizon
+         << setw(14) << fixed << setprecision(0) << events / seconds
+         << setw(14) << scientific << setprecision(1) << resolution
+         << setw(14) << fixed << setprecision(5) << fabs(m.avgTurnTime - expectedTurnTime) / expectedTurnTime
+         << setw(14) << fabs(m.utilization[0] - lambda) / lambda
+         << setw(14) << fabs(m.avgProcessesInQ[0] - expectedQueue) / expectedQueue << endl;
+  }
+
+  return 0;
+}
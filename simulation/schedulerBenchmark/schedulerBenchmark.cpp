@@ -0,0 +1,64 @@
+#include "../Simulation.h"
+#include "../SimulationConfig.h"
+#include "../SimulationMetrics.h"
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+
+using namespace std;
+
+// Runs every scheduler on the same workload (4 CPUs sharing one ready
+//   queue at 90% load, 2,000,000 processes) and reports events per second.
+//   Priority gets the same load split over two classes at priorities 0 and
+//   1, since with a single class every process would share priority 0.
+// Built twice by the makefile: schedulerBenchmark runs the event loop
+//   specialized for each scheduler policy, schedulerBenchmarkRuntime
+//   (-DRUNTIME_SCHEDULER_DISPATCH) runs one loop that checks the scheduler
+//   type on every Ready Queue operation. Both produce the same results, so
+//   comparing the two shows what the specialization is worth.
+int main() {
+  const char *names[] = {"FCFS", "SJF", "SRTF", "HRRN", "RR", "MLFQ", "Priority"};
+  const int repetitions = 5;    // Best of, to filter out noise
+
+#ifdef RUNTIME_SCHEDULER_DISPATCH
+  cout << "Scheduler dispatch: runtime" << endl;
+#else
+  cout << "Scheduler dispatch: specialized per policy" << endl;
+#endif
+
+  cout << setw(10) << "scheduler" << setw(12) << "events" << setw(14) << "events/s" << setw(14) << "turn time" << endl;
+
+  for (int scheduler = 0; scheduler <= 6; scheduler++) {
+    SimulationConfig config;
+    config.arrivalLambda = 1.0;
+    config.serviceTimeAvg = 3.6;
+    config.schedulerType = scheduler;
+    config.quantum = scheduler == 4 ? 1.0 : 0;
+    config.processClasses = scheduler == 6 ? "0.5/3.6/0;0.5/3.6/1" : "";
+    config.rqSetup = 2;
+    config.numCPUs = 4;
+    config.eventQueueType = HEAP_QUEUE;
+    config.endCondition = PROCESSES_DEPARTED;
+    config.N = 2000000;
+    config.histogramBins = 0;
+    config.seed = 1;
+
+    SimulationMetrics m;
+    double best = 0;
+    for (int r = 0; r < repetitions; r++) {
+      auto start = chrono::steady_clock::now();
+      Simulation simulation(config);
+      m = simulation.run();
+      auto end = chrono::steady_clock::now();
+
+      double seconds = chrono::duration<double>(end - start).count();
+      if (r == 0 || seconds < best) best = seconds;
+    }
+
+    cout << setw(10) << names[scheduler] << setw(12) << m.numEvents
+         << setw(14) << fixed << setprecision(0) << m.numEvents / best
+         << setw(14) << setprecision(4) << m.avgTurnTime << endl;
+  }
+
+  return 0;
+}
@@ -12,17 +12,17 @@
 */
 
 
-#include "endChecker/endChecker.h"
-#include "generators/RandomGenerator.h"
-#include "generators/TimeGenerator.h"
 #include "input/InputHandler.h"
 #include "output/output.h"
 #include "output/terminalOutput.h"
-#include "processes/Process.h"
-#include "processes/ReadyQueueList.h"
-#include "processes/CPUList.h"
-#include "statistics/StatisticsUnit.h"
+#include "simulation/Simulation.h"
+#include "sweep/ReplicationRunner.h"
+#include "sweep/SweepRunner.h"
 #include "config.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
 #include <vector>
 #include <stdexcept>
 
@@ -30,206 +30,126 @@ using namespace std;
 
 
 // ====================================================================
-// Event structures
-enum EventType {
-  ARRIVAL,
-  DEPARTURE,
-  PREEMPTION
-};
-
-struct Event {
-  float time;
-  EventType type;
-  Process *process;
-  Event *next;
-};
+// Prints the tail of the turnaround, waiting and response time
+//   distributions, if the sketches were kept.
+void printPercentiles(Output *out, const QuantileSketch &turnTimes, const QuantileSketch &waitTimes, const QuantileSketch &responseTimes) {
+  if (!turnTimes.isEnabled()) {
+    return;
+  }
+
+  const vector<float> quantiles = {0.5, 0.9, 0.95, 0.99, 0.999};
+  vector<vector<float>> values(3);
+  for (float q : quantiles) {
+    values[0].push_back(turnTimes.getQuantile(q));
+    values[1].push_back(waitTimes.getQuantile(q));
+    values[2].push_back(responseTimes.getQuantile(q));
+  }
+  out->printPercentiles({Output::TURN_TIME_PERCENTILES, Output::WAIT_TIME_PERCENTILES, Output::RESPONSE_TIME_PERCENTILES},
+                        quantiles, values);
+}
 
 
 // ====================================================================
-// GLOBAL VARIABLES
-int schedulerType = 0; // 0 = FCFS, 1 = SJF, 2 = SRTF
-Event *eventQHead = nullptr;
-
-RandomGenerator *randGen = nullptr;
-TimeGenerator *timeGen = nullptr;
-StatisticsUnit *stats = nullptr;
-
-CPUList *cpuList = nullptr;
-ReadyQueueList *RQList = nullptr;
+// Sweep mode: runs a grid of configurations in parallel and writes a CSV
+//   table instead of prompting for a single run.
+int runSweep(string gridFile, int numThreads, string outFile) {
+  SweepRunner sweep(gridFile);
+  cerr << "Running " << sweep.getNumJobs() << " simulations..." << endl;
+  sweep.run(numThreads);
 
-Output *out = nullptr;
-
-
-// ====================================================================
-// Inserts new event for an arrival or departure to Event Queue.
-void scheduleEvent(EventType type, float t, Process *process) {
-  // Create new event
-  Event *event = new Event;
-  event->type = type;
-  event->time = t;
-  event->process = process;
-  event->next = nullptr;
-
-  // Insert event into Event Queue sorted by accending times
-  if (!eventQHead || t < eventQHead->time) {
-    event->next = eventQHead;
-    eventQHead = event;
+  if (outFile.empty()) {
+    sweep.writeResults(cout);
   }
   else {
-    Event *p = eventQHead;
-    while (p->next && p->next->time < t) {
-      p = p->next;
+    ofstream file(outFile);
+    if (!file) {
+      throw runtime_error("Could not open " + outFile + " for writing.");
     }
-    event->next = p->next;
-    p->next = event;
+    sweep.writeResults(file);
   }
-}
 
-
-// ====================================================================
-// Finds and deletes an event from the Event Queue.
-// Returns true if event was found and deleted, false otherwise.
-bool findAndDeleteEvent(EventType type, Process *target) {
-  Event *prev = nullptr;
-  Event *current = eventQHead;
-  while (current) {
-    if (current->type == type && current->process == target) {
-      if (prev) {
-        prev->next = current->next;
-      }
-      else {
-        eventQHead = current->next;
-      }
-      delete current;
-      return true;
-    }
-    prev = current;
-    current = current->next;
-  }
-  return false;
+  return 0;
 }
 
 
 // ====================================================================
-// Handle an arrival event (process arrives to system)
-// Generates next arrival based on clock.
-// Assigns e's process to the CPU (if idle), or inserts it into the Ready Queue.
-void handleArrival(Event *e, float clock) {
-  float nextArrivalTime = clock + timeGen->getInterArrivalTime();
-  scheduleEvent(ARRIVAL, nextArrivalTime, new Process(timeGen->getServiceTime(), nextArrivalTime)); // Next arrival
-
-  int CPUindex = 0;
-  int RQindex = 0;
-  if (RQList->getNumRQs() == 1) {   // Single Ready Queue setup
-    vector<int> idleCPUs = cpuList->getIdleCPUs();
-    if (idleCPUs.size() > 0) {
-      CPUindex = idleCPUs[randGen->getRandomIndex(idleCPUs.size())];  // Pick random idle CPU
-    }
-  }
-  else {                            // Per-CPU Ready Queue setup
-    CPUindex = randGen->getRandomIndex(cpuList->getNumCPUs());
-    RQindex = CPUindex;
-  }
+// Replication mode: runs independent replications of the configuration and
+//   prints 95% confidence intervals instead of single values.
+int runReplications(Output *out, SimulationConfig config, int replications, float precision, int numThreads) {
+  ReplicationRunner *runner = new ReplicationRunner(config, replications, precision);
 
-  Output::LiveUpdateType eventType;
-  Process *currentProcess = nullptr;
-  
-  if (cpuList->isCPUIdle(CPUindex)) {            // Target CPU is idle
-    e->process->RQindex = RQindex;
-    cpuList->assignProcessToCPU(clock, e->process, CPUindex);
-    scheduleEvent(DEPARTURE, clock + e->process->serviceTime, e->process);
-    eventType = Output::ARRIVAL_TO_CPU;
-  }
-  else {     // Target CPU is busy, add to its Ready Queue, but check for preemption
-    RQList->insertProcessRQ(e->process, RQindex);
-    stats->sampleRQueue(clock, RQindex);
-
-    currentProcess = cpuList->getProcessOnCPU(CPUindex);
-    float timeLeft = currentProcess->timeLeft - (clock - currentProcess->lastRunTime);
-    if (schedulerType == 2 && e->process->serviceTime < timeLeft) {  // SRTF & preempt process on CPU
-      e->process->CPUindex = CPUindex;
-      scheduleEvent(PREEMPTION, clock, currentProcess);
-      eventType = Output::ARRIVAL_PREEMPT_SRTF;
-    }
-    else {
-      eventType = Output::ARRIVAL_TO_RQ;
-    }
-  }
+  out->printHeader("Initialization Complete");
 
-  if (PRINT_LIVE_UPDATES) out->printLiveUpdate(clock, eventType, e->process, RQList, currentProcess);
-}
+  ReplicationResults results = runner->run(numThreads);
 
+  out->printHeader(results.precisionReached ? "Simulation Complete" : "Simulation Stopped at Replication Limit");
 
-// ====================================================================
-// Handle a departure event (process is finished on CPU)
-// Deletes e's process.
-// Next process is pulled from the Ready Queue, or the CPU goes idle if empty.
-void handleDeparture(Event *e, float clock) {
-  stats->processDone(e->process, clock);
-
-  int CPUindex = e->process->CPUindex;
-  if (cpuList->getProcessOnCPU(CPUindex)->id != e->process->id) {
-    throw runtime_error("Error: Process on CPU does not match departing process.");
-  }
+  auto print = [out](Output::MetricType metricType, vector<ConfidenceInterval> intervals) {
+    vector<float> means, halfWidths;
+    for (ConfidenceInterval interval : intervals) {
+      means.push_back(interval.mean);
+      halfWidths.push_back(interval.halfWidth);
+    }
+    out->printInterval(metricType, means, halfWidths);
+  };
 
-  int RQindex = 0;
-  if (RQList->getNumRQs() != 1) {             // Get correct Ready Queue index
-    RQindex = CPUindex;
+  out->printMetric(Output::REPLICATIONS, {float(results.replications)});
+  print(Output::AVG_TURN_TIME, {results.avgTurnTime});
+  print(Output::TOTAL_THROUGHPUT, {results.throughput});
+  print(Output::CPU_UTILIZATION, results.utilization);
+  print(Output::AVG_PROCESSES_IN_Q, results.avgProcessesInQ);
+  if (!results.processClassAvgTurnTime.empty()) {
+    print(Output::PROCESS_CLASS_AVG_TURN_TIME, results.processClassAvgTurnTime);
+    print(Output::PROCESS_CLASS_AVG_WAIT_TIME, results.processClassAvgWaitTime);
   }
+  printPercentiles(out, results.turnTimes, results.waitTimes, results.responseTimes);
 
-  Output::LiveUpdateType eventType;
-  Process *nextProcess = nullptr;
+  out->printHeader("Statistics Complete");
 
-  cpuList->removeProcessFromCPU(clock, CPUindex);
+  delete runner;
 
-  if (RQList->isRQEmpty(RQindex)) {           // Target Ready Queue is empty
-    eventType = Output::DEPARTURE_CPU_IDLE;
-  }
-  else {                                      // Target Ready Queue is not empty, move next process to target CPU
-    nextProcess = RQList->dequeueProcessRQ(clock, RQindex);
-    cpuList->assignProcessToCPU(clock, nextProcess, CPUindex);
-    stats->sampleRQueue(clock, RQindex);
-    scheduleEvent(DEPARTURE, clock + nextProcess->serviceTime, nextProcess);
-    eventType = Output::DEPARTURE_NEXT_PROCESS;
-  }
+  out->printHeader("Cleanup Complete");
 
-  if (PRINT_LIVE_UPDATES) out->printLiveUpdate(clock, eventType, e->process, RQList, nextProcess);
+  delete out;
 
-  delete e->process;
+  return 0;
 }
 
 
 // ====================================================================
-// Handle a preemption event (process is interrupted while running on CPU)
-// Puts e's process back into the Ready Queue and puts next process on CPU.
-// Puts the process back on the CPU if the Ready Queue is empty. 
-void handlePreemption(Event *e, float clock) {
-  int CPUindex = e->process->CPUindex;
-  if (e->process->id != cpuList->getProcessOnCPU(CPUindex)->id) {
-    throw runtime_error("Error: Process on CPU does not match preempted process.");
+// Command line options (all optional):
+//   --sweep <grid file>   Run a parameter sweep (see README.md)
+//   --out <file>          Where to write the sweep table (default: terminal)
+//   --replicate <K>       Run K independent replications and print confidence intervals
+//   --precision <p>       Keep replicating in waves of K until the intervals are within p of the mean
+//   --threads <N>         Threads for sweeps and replications (default: one per core)
+//   --trace <file>        Replay arrivals and service times from a binary trace
+int main(int argc, char *argv[]) {
+  string gridFile;
+  string outFile;
+  int numThreads = 0;
+  int replications = 0;
+  float precision = 0;
+  string traceFile = TRACE_FILE;
+
+  for (int i = 1; i < argc; i++) {
+    if (i + 1 >= argc) {
+      throw runtime_error(string("Missing value for ") + argv[i] + ".");
+    }
+    if (strcmp(argv[i], "--sweep") == 0) gridFile = argv[++i];
+    else if (strcmp(argv[i], "--out") == 0) outFile = argv[++i];
+    else if (strcmp(argv[i], "--replicate") == 0) replications = stoi(argv[++i]);
+    else if (strcmp(argv[i], "--precision") == 0) precision = stof(argv[++i]);
+    else if (strcmp(argv[i], "--threads") == 0) numThreads = stoi(argv[++i]);
+    else if (strcmp(argv[i], "--trace") == 0) traceFile = argv[++i];
+    else throw runtime_error(string("Unknown argument ") + argv[i] + ".");
   }
 
-  int RQindex = 0;
-  if (RQList->getNumRQs() != 1) {
-    RQindex = CPUindex;
+  if (!gridFile.empty()) {
+    return runSweep(gridFile, numThreads, outFile);
   }
 
-  Process *process = cpuList->removeProcessFromCPU(clock, CPUindex);    // Put process into Ready Queue
-  findAndDeleteEvent(DEPARTURE, process);
-  RQList->insertProcessRQ(process, RQindex);
-
-  Process *nextProcess = RQList->dequeueProcessRQ(clock, RQindex);      // Move next process in RQ to CPU
-  cpuList->assignProcessToCPU(clock, nextProcess, CPUindex);
-  scheduleEvent(DEPARTURE, clock + nextProcess->timeLeft, nextProcess);
-
-  bool arrivalPreempt = nextProcess->arrivalTime == clock;
-  if (PRINT_LIVE_UPDATES && !arrivalPreempt) out->printLiveUpdate(clock, Output::PREEMPTION_INTERVAL, process, RQList, nextProcess);
-}
-
-
-// ====================================================================
-int main() {
-  out = new TerminalOutput();
+  Output *out = new TerminalOutput();
 
   out->printTitle();
 
@@ -238,36 +158,33 @@ int main() {
   // ======================
 
   // User arguments
-  float arrivalLambda;
-  float serviceTimeAvg;
-  int numCPUs;
-  int rqSetup;
-
-  arrivalLambda = InputHandler::getInput<float>(InputHandler::ARRIVAL_RATE);
-  serviceTimeAvg = InputHandler::getInput<float>(InputHandler::SERVICE_TIME);
-  schedulerType = InputHandler::getInput<int>(InputHandler::SCHEDULER);
-  rqSetup = InputHandler::getInput<int>(InputHandler::RQ_SETUP);
-  numCPUs = InputHandler::getInput<int>(InputHandler::NUM_CPUS);
-
-  EndChecker endChecker;
-
-  if (arrivalLambda <= 0 || serviceTimeAvg <= 0 || (schedulerType < 0 || 3 < schedulerType) || numCPUs <= 0 || !(rqSetup == 1 || rqSetup == 2)) {
-    throw runtime_error("Invalid user-input arguments.");
+  SimulationConfig config;
+  config.traceFile = traceFile;
+  if (traceFile.empty()) {          // A trace gives the arrivals and service times itself
+    config.arrivalLambda = InputHandler::getInput<float>(InputHandler::ARRIVAL_RATE);
+    config.serviceTimeAvg = InputHandler::getInput<float>(InputHandler::SERVICE_TIME);
   }
+  config.schedulerType = InputHandler::getInput<int>(InputHandler::SCHEDULER);
+  if (config.schedulerType == 4) {
+    config.quantum = InputHandler::getInput<float>(InputHandler::QUANTUM);
+  }
+  config.rqSetup = InputHandler::getInput<int>(InputHandler::RQ_SETUP);
+  config.numCPUs = InputHandler::getInput<int>(InputHandler::NUM_CPUS);
+  config.eventQueueType = static_cast<EventQueueType>(InputHandler::getInput<int>(InputHandler::EVENT_QUEUE));
 
-  int numRQs = rqSetup == 2 ? 1 : numCPUs;
-
-  randGen = new RandomGenerator();
-  timeGen = new TimeGenerator(arrivalLambda, serviceTimeAvg);
-  cpuList = new CPUList(numCPUs);
-  RQList = new ReadyQueueList(schedulerType, numRQs);
-  stats = new StatisticsUnit(arrivalLambda, cpuList, RQList);
+  config.endCondition = static_cast<EndCondition>(InputHandler::getInput<int>(InputHandler::END_CONDITION));
+  if (config.endCondition == TIME_LIMIT) {
+    config.timeLimit = InputHandler::getInput<float>(InputHandler::TIME_LIMIT);
+  }
+  else {
+    config.N = InputHandler::getInput<int>(InputHandler::N);
+  }
 
-  float clock = 0.0; // Current time tracker
+  if (replications > 0) {
+    return runReplications(out, config, replications, precision, numThreads);
+  }
 
-  // Create first process
-  Process *firstProcess = new Process(timeGen->getServiceTime(), clock);
-  scheduleEvent(ARRIVAL, firstProcess->arrivalTime, firstProcess);
+  Simulation *simulation = new Simulation(config, out);
 
   out->printHeader("Initialization Complete");
 
@@ -275,39 +192,7 @@ int main() {
   // SIMULATION
   // ======================
 
-  while (!endChecker.checkEnd()) {
-    Event *event = eventQHead;
-    if (!event) {
-      throw runtime_error("Error: Event queue is empty.");
-    }
-
-    float oldClock = clock;
-    clock = event->time;
-    float timeDiff = clock - oldClock;
-
-
-    switch (event->type) {
-      case ARRIVAL: 
-        handleArrival(event, clock);
-        endChecker.logArrival(clock);
-        break;
-
-      case DEPARTURE:
-        handleDeparture(event, clock);
-        endChecker.logDeparture(clock);
-        break;
-
-      case PREEMPTION:
-        handlePreemption(event, clock);
-        break;
-
-      default: 
-        throw runtime_error("Encountered invalid event type.");
-    }
-
-    eventQHead = eventQHead->next;
-    delete event;
-  }
+  SimulationMetrics metrics = simulation->run();
 
   out->printHeader("Simulation Complete");
 
@@ -315,22 +200,39 @@ int main() {
   // STATISTICS
   // ======================
 
-  out->printMetric(Output::AVG_TURN_TIME, {stats->getAvgTurnTime()});
+  out->printMetric(Output::AVG_TURN_TIME, {metrics.avgTurnTime});
+  out->printMetric(Output::TOTAL_THROUGHPUT, {metrics.throughput});
+  out->printMetric(Output::CPU_UTILIZATION, metrics.utilization);
+  out->printMetric(Output::AVG_PROCESSES_IN_Q, metrics.avgProcessesInQ);
+
+  if (!metrics.migrationsIn.empty()) {
+    out->printMetric(Output::MIGRATIONS_IN, vector<float>(metrics.migrationsIn.begin(), metrics.migrationsIn.end()));
+    out->printMetric(Output::MIGRATIONS_OUT, vector<float>(metrics.migrationsOut.begin(), metrics.migrationsOut.end()));
+  }
 
-  out->printMetric(Output::TOTAL_THROUGHPUT, {stats->getThroughput(clock)});
+  if (!metrics.classAvgTurnTime.empty()) {
+    out->printMetric(Output::CLASS_AVG_TURN_TIME, metrics.classAvgTurnTime);
+    out->printMetric(Output::CLASS_THROUGHPUT, metrics.classThroughput);
+    out->printMetric(Output::CLASS_UTILIZATION, metrics.classUtilization);
+  }
 
-  vector<float> utilizationValues;
-  for (int i = 0; i < cpuList->getNumCPUs(); i++) {
-    utilizationValues.push_back(stats->getUtilization(clock, i));
+  if (!metrics.processClassAvgTurnTime.empty()) {
+    out->printMetric(Output::PROCESS_CLASS_AVG_TURN_TIME, metrics.processClassAvgTurnTime);
+    out->printMetric(Output::PROCESS_CLASS_AVG_WAIT_TIME, metrics.processClassAvgWaitTime);
+    out->printMetric(Output::PROCESS_CLASS_AVG_SLOWDOWN, metrics.processClassAvgSlowdown);
+    out->printMetric(Output::PROCESS_CLASS_THROUGHPUT, metrics.processClassThroughput);
   }
-  out->printMetric(Output::CPU_UTILIZATION, utilizationValues);
 
-  vector<float> processesInQValues;
-  for (int i = 0; i < RQList->getNumRQs(); i++) {
-    processesInQValues.push_back(stats->getAvgProcessesInQ(clock, i));
+  printPercentiles(out, metrics.turnTimes, metrics.waitTimes, metrics.responseTimes);
+
+  for (int i = 0; i < metrics.RQLengthDistributions.size(); i++) {
+    out->printDistribution(Output::RQ_LENGTH_DISTRIBUTION, i, metrics.RQLengthDistributions[i]);
   }
-  out->printMetric(Output::AVG_PROCESSES_IN_Q, processesInQValues);
 
+  if (PRINT_POOL_STATS) {
+    out->printMetric(Output::PEAK_PROCESSES, {float(metrics.peakProcesses)});
+    out->printMetric(Output::PEAK_EVENTS, {float(metrics.peakEvents)});
+  }
 
   out->printHeader("Statistics Complete");
 
@@ -338,23 +240,11 @@ int main() {
   // CLEANUP
   // ======================
 
-  delete timeGen;
-  delete randGen;
-  delete stats;
-  delete cpuList;
-  delete RQList;
-
-  Event *e = eventQHead;
-  while (eventQHead) {
-    eventQHead = eventQHead->next;
-    if (e->type == ARRIVAL) delete e->process;
-    delete e;
-    e = eventQHead;
-  }
+  delete simulation;
 
   out->printHeader("Cleanup Complete");
 
   delete out;
 
   return 0;
-}
\ No newline at end of file
+}
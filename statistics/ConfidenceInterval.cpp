@@ -0,0 +1,46 @@
+#include "ConfidenceInterval.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// 0.975 quantiles of the t distribution for 1 to 30 degrees of freedom
+static const double T_QUANTILES[30] = {
+  12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+  2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+  2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+};
+
+// Past 30 degrees of freedom, the Cornish-Fisher expansion around the normal
+//   quantile is accurate to better than 0.001.
+static double tQuantile(int degreesOfFreedom) {
+  if (degreesOfFreedom <= 30) {
+    return T_QUANTILES[degreesOfFreedom - 1];
+  }
+  const double z = 1.959964;
+  double df = degreesOfFreedom;
+  return z + (z*z*z + z) / (4*df) + (5*pow(z, 5) + 16*z*z*z + 3*z) / (96*df*df);
+}
+
+ConfidenceInterval ConfidenceInterval::fromSamples(const vector<double> &samples) {
+  int n = samples.size();
+  if (n < 2) {
+    throw runtime_error("A confidence interval needs at least 2 samples.");
+  }
+
+  double sum = 0;
+  for (double x : samples) sum += x;
+  double mean = sum / n;
+
+  double squares = 0;
+  for (double x : samples) squares += (x - mean) * (x - mean);
+  double stdError = sqrt(squares / (n - 1) / n);
+
+  return {float(mean), float(tQuantile(n - 1) * stdError)};
+}
+
+float ConfidenceInterval::relativeHalfWidth() const {
+  if (mean == 0) {
+    return halfWidth == 0 ? 0 : numeric_limits<float>::infinity();
+  }
+  return halfWidth / fabs(mean);
+}
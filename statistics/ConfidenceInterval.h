@@ -0,0 +1,22 @@
+#ifndef CONFIDENCEINTERVAL_H
+#define CONFIDENCEINTERVAL_H
+
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// 95% confidence interval for the mean of independent samples, using the
+//   Student t distribution.
+struct ConfidenceInterval {
+  float mean;
+  float halfWidth;
+
+  // Needs at least 2 samples
+  static ConfidenceInterval fromSamples(const vector<double> &);
+
+  // Half-width as a fraction of the mean (infinite if the mean is 0)
+  float relativeHalfWidth() const;
+};
+
+#endif // CONFIDENCEINTERVAL_H
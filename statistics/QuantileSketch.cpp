@@ -0,0 +1,70 @@
+#include "QuantileSketch.h"
+#include <stdexcept>
+
+QuantileSketch::QuantileSketch(double relativeAccuracy) {
+  if (relativeAccuracy < 0 || relativeAccuracy >= 1) {
+    throw runtime_error("Quantile accuracy must be from 0 up to 1.");
+  }
+  this->relativeAccuracy = relativeAccuracy;
+  gamma = (1 + relativeAccuracy) / (1 - relativeAccuracy);
+  invLogGamma = relativeAccuracy > 0 ? 1 / log(gamma) : 0;
+  maxIndex = relativeAccuracy > 0 ? int(ceil(log(MAX_VALUE / MIN_VALUE) * invLogGamma)) : 0;
+  firstIndex = 0;
+  count = 0;
+}
+
+// Extends the stored range of buckets to include index.
+void QuantileSketch::grow(int index) {
+  if (counts.empty()) {
+    firstIndex = index;
+    counts.assign(1, 0);
+    return;
+  }
+  int lastIndex = firstIndex + counts.size() - 1;
+  if (index < firstIndex) {
+    counts.insert(counts.begin(), firstIndex - index, 0);
+    firstIndex = index;
+  }
+  else if (index > lastIndex) {
+    counts.resize(index - firstIndex + 1, 0);
+  }
+}
+
+// Value within the relative accuracy of everything in the bucket.
+double QuantileSketch::bucketValue(int index) const {
+  if (index == 0) return 0;
+  return MIN_VALUE * 2 * pow(gamma, index) / (gamma + 1);
+}
+
+void QuantileSketch::merge(const QuantileSketch &other) {
+  if (other.relativeAccuracy != relativeAccuracy) {
+    throw runtime_error("Error: Cannot merge quantile sketches with different accuracies.");
+  }
+  if (other.counts.empty()) return;
+  grow(other.firstIndex);
+  grow(other.firstIndex + other.counts.size() - 1);
+  for (int i = 0; i < other.counts.size(); i++) {
+    counts[other.firstIndex + i - firstIndex] += other.counts[i];
+  }
+  count += other.count;
+}
+
+bool QuantileSketch::isEnabled() const {
+  return relativeAccuracy > 0;
+}
+
+uint64_t QuantileSketch::getCount() const {
+  return count;
+}
+
+// Walks the buckets to the one holding the value of rank q * (count - 1).
+double QuantileSketch::getQuantile(double q) const {
+  if (count == 0) return 0;
+  uint64_t rank = uint64_t(q * (count - 1));
+  uint64_t seen = 0;
+  for (int i = 0; i < counts.size(); i++) {
+    seen += counts[i];
+    if (seen > rank) return bucketValue(firstIndex + i);
+  }
+  return bucketValue(firstIndex + counts.size() - 1);
+}
@@ -0,0 +1,61 @@
+#ifndef QUANTILESKETCH_H
+#define QUANTILESKETCH_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Streaming quantile estimate of non-negative values (in seconds), after
+//   DDSketch (Masson, Rim and Lee).
+// Values go into buckets growing geometrically by gamma = (1 + a) / (1 - a),
+//   so every quantile is returned within a relative error a of a value of
+//   that rank. Values up to MIN_VALUE count as 0 and values above MAX_VALUE
+//   as MAX_VALUE, which bounds the buckets to about 2000 at a = 0.01 however
+//   many values are added. Only the range of buckets actually hit is stored.
+// Adding a value is a log and an increment. Sketches with the same accuracy
+//   merge exactly, by adding their bucket counts, so replications can be
+//   combined into one distribution.
+class QuantileSketch {
+  private:
+    static constexpr double MIN_VALUE = 1e-9;
+    static constexpr double MAX_VALUE = 1e9;
+
+    double relativeAccuracy;
+    double gamma;
+    double invLogGamma;
+    int maxIndex;
+
+    vector<uint64_t> counts;    // Bucket firstIndex + i, bucket 0 holds values up to MIN_VALUE
+    int firstIndex;
+    uint64_t count;
+
+    void grow(int);
+    double bucketValue(int) const;
+
+  public:
+    // relativeAccuracy = 0 makes an empty sketch that ignores values
+    QuantileSketch(double = 0);
+
+    void add(double value) {
+      if (relativeAccuracy == 0) return;
+      int index = value <= MIN_VALUE ? 0 : int(ceil(log(value / MIN_VALUE) * invLogGamma));
+      if (index > maxIndex) index = maxIndex;
+      if (index < firstIndex || index >= firstIndex + int(counts.size())) grow(index);
+      counts[index - firstIndex]++;
+      count++;
+    }
+
+    // Throws runtime_error if the accuracies differ
+    void merge(const QuantileSketch &);
+
+    bool isEnabled() const;
+    uint64_t getCount() const;
+
+    // Value at quantile q (0 to 1), 0 if the sketch is empty
+    double getQuantile(double) const;
+};
+
+#endif // QUANTILESKETCH_H
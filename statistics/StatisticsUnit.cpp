@@ -1,58 +1,90 @@
 #include "StatisticsUnit.h"
+#include <algorithm>
 
-// Variables used for calculating avgProcessesInQ
-struct StatisticsUnit::queueSample {
-  int numOfProcesses;
-  float sampleTime;
-  queueSample *next;
-};
-
-// Constructor: initializes to default values and 
-// sets sample time differential based on arrivalRate.
-StatisticsUnit::StatisticsUnit(float arrivalRate, CPUList *cpuList, ReadyQueueList *RQList) {
+// Constructor: initializes to default values.
+// histogramBins > 0 also tracks the distribution of each Ready Queue's length,
+//   and quantileAccuracy > 0 the percentiles of turnaround, waiting and
+//   response times to that relative accuracy.
+StatisticsUnit::StatisticsUnit(ProcessTable *processes, CPUList *cpuList, ReadyQueueList *RQList, int histogramBins,
+                               int numProcessClasses, float quantileAccuracy)
+  : turnTimes(quantileAccuracy), waitTimes(quantileAccuracy), responseTimes(quantileAccuracy) {
+  this->processes = processes;
   this->cpuList = cpuList;
   this->RQList = RQList;
+  this->histogramBins = histogramBins;
   
   totalTurnTime = 0.0;
-  numProcessesDone = 0.0;
+  numProcessesDone = 0;
+  classTurnTimes = vector<double>(cpuList->getNumClasses(), 0.0);
+  classProcessesDone = vector<long long>(cpuList->getNumClasses(), 0);
+  processClassTotals = vector<ProcessClassTotals>(numProcessClasses, {0.0, 0.0, 0.0, 0});
 
-  utilizationTimes = vector<float>(cpuList->getNumCPUs(), 0.0);
-  sampleHeads = vector<queueSample *>(RQList->getNumRQs(), nullptr);
-  sampleTimeDiff = 0.5 / arrivalRate;
+  utilizationTimes = vector<SimTime>(cpuList->getNumCPUs(), SimTime());
+  RQTrackers = vector<queueLengthTracker>(RQList->getNumRQs(), {0, SimTime(), 0.0, vector<double>(histogramBins, 0.0)});
+  migrationsIn = vector<long long>(RQList->getNumRQs(), 0);
+  migrationsOut = vector<long long>(RQList->getNumRQs(), 0);
 }
 
-// Destructor: deletes dynamically-allocated memory for sample list
-StatisticsUnit::~StatisticsUnit() {
-  for (int i = 0; i < sampleHeads.size(); i++) {
-    queueSample *p = sampleHeads[i];
-    while (p) {
-      sampleHeads[i] = sampleHeads[i]->next;
-      delete p;
-      p = sampleHeads[i];
-    }
-  }
+// Account for a process going on a CPU for the first time.
+void StatisticsUnit::processStarted(ProcessIndex process, SimTime time) {
+  responseTimes.add(toSeconds(time - processes->arrivalTime[process]));
 }
 
-// Account for a process that has finished at given time. 
-void StatisticsUnit::processDone(Process *process, float time) {
-  totalTurnTime += time - process->arrivalTime;
+// Account for a process that has finished at given time, while still on
+//   its CPU.
+void StatisticsUnit::processDone(ProcessIndex process, SimTime time) {
+  double turnTime = toSeconds(time - processes->arrivalTime[process]);
+  totalTurnTime += turnTime;
   numProcessesDone++;
-  utilizationTimes[process->CPUindex] += process->serviceTime;
+
+  int classIndex = cpuList->getCPUClass(processes->CPUindex[process]);
+  classTurnTimes[classIndex] += turnTime;
+  classProcessesDone[classIndex]++;
+
+  // Time on CPUs so far plus the run that is ending now
+  double runTime = toSeconds(processes->cpuTime[process] + (time - processes->lastRunTime[process]));
+  double serviceTime = toSeconds(processes->serviceTime[process]);
+  ProcessClassTotals &totals = processClassTotals[processes->processClass[process]];
+  totals.turnTime += turnTime;
+  totals.waitTime += turnTime - runTime;
+  totals.slowdown += serviceTime > 0 ? turnTime / serviceTime : 1.0;
+  totals.numDone++;
+
+  turnTimes.add(turnTime);
+  waitTimes.add(turnTime - runTime);
+}
+
+// Makes room for workload classes up to numProcessClasses - 1, such as new
+//   class ids met in a trace.
+void StatisticsUnit::setNumProcessClasses(int numProcessClasses) {
+  processClassTotals.resize(numProcessClasses, {0.0, 0.0, 0.0, 0});
+}
+
+// Account for a CPU having run a process for the given length of time.
+// Called every time a process leaves a CPU, since a preempted process may
+//   finish on a different CPU.
+void StatisticsUnit::logRun(int CPUindex, SimTime runTime) {
+  utilizationTimes[CPUindex] += runTime;
+}
+
+// Account for a process moving from one Ready Queue (and its CPU) to another.
+void StatisticsUnit::logMigration(int fromRQindex, int toRQindex) {
+  migrationsOut[fromRQindex]++;
+  migrationsIn[toRQindex]++;
 }
 
-// Samples the Ready Queue at discrete time intervals up to the
-// given time, which should be when the Ready Queue size was updated.
+// Records that the Ready Queue's length changed at the given time, adding
+//   the previous length's contribution up to then to the running integral.
 // Should be called on every update of the Ready Queue size.
-void StatisticsUnit::sampleRQueue(float time, int RQindex = 0) {
-  float lastSampleTime = sampleHeads[RQindex] ? sampleHeads[RQindex]->sampleTime : 0.0;
-  while (lastSampleTime < time) {
-    lastSampleTime += sampleTimeDiff;
-    queueSample *p = new queueSample;
-    p->numOfProcesses = RQList->getRQSize(RQindex);
-    p->next = sampleHeads[RQindex];
-    p->sampleTime = lastSampleTime;
-    sampleHeads[RQindex] = p;
+void StatisticsUnit::sampleRQueue(SimTime time, int RQindex = 0) {
+  queueLengthTracker &tracker = RQTrackers[RQindex];
+  double dt = toSeconds(time - tracker.lastUpdateTime);
+  tracker.lengthTimeIntegral += tracker.length * dt;
+  if (histogramBins > 0) {
+    tracker.timeAtLength[min(tracker.length, histogramBins - 1)] += dt;
   }
+  tracker.length = RQList->getRQSize(RQindex);
+  tracker.lastUpdateTime = time;
 }
 
 // Get the average turnaround time for the system.
@@ -61,28 +93,119 @@ float StatisticsUnit::getAvgTurnTime() {
 }
 
 // Get the throughput for the system up to time totalTime.
-float StatisticsUnit::getThroughput(float totalTime) {
-  return numProcessesDone / totalTime;
+float StatisticsUnit::getThroughput(SimTime totalTime) {
+  return numProcessesDone / toSeconds(totalTime);
 }
 
 // Get the average utilization of the system up to time totalTime.
-float StatisticsUnit::getUtilization(float totalTime, int CPUindex) {
-  return utilizationTimes[CPUindex] / totalTime;
+float StatisticsUnit::getUtilization(SimTime totalTime, int CPUindex) {
+  return toSeconds(utilizationTimes[CPUindex]) / toSeconds(totalTime);
 }
 
-// Get the average number of processes in the Ready Queue up to time totalTime. 
-float StatisticsUnit::getAvgProcessesInQ(float totalTime, int RQindex) {
-  // Run sample to capture end of simulation data. Extraneous in some cases but doesn't hurt.
-  sampleRQueue(totalTime, RQindex); 
+// Get the time-weighted average number of processes in the Ready Queue up to time totalTime. 
+float StatisticsUnit::getAvgProcessesInQ(SimTime totalTime, int RQindex) {
+  if (totalTime <= SimTime()) return 0.0;
+  queueLengthTracker &tracker = RQTrackers[RQindex];
+  double integral = tracker.lengthTimeIntegral + tracker.length * toSeconds(totalTime - tracker.lastUpdateTime);
+  return integral / toSeconds(totalTime);
+}
 
-  int n = 0;
-  float sum = 0;
-  queueSample *p = sampleHeads[RQindex];
+// Get the fraction of time up to totalTime that the Ready Queue held each
+//   number of processes. The last value covers that length or more.
+// Empty if the statistics unit was created without histogram bins.
+vector<float> StatisticsUnit::getRQLengthDistribution(SimTime totalTime, int RQindex) {
+  vector<float> fractions;
+  if (histogramBins == 0 || totalTime <= SimTime()) return fractions;
 
-  while (p) {
-    sum += p->numOfProcesses;
-    n++;
-    p = p->next;
+  queueLengthTracker &tracker = RQTrackers[RQindex];
+  for (int i = 0; i < histogramBins; i++) {
+    double time = tracker.timeAtLength[i];
+    if (i == min(tracker.length, histogramBins - 1)) {
+      time += toSeconds(totalTime - tracker.lastUpdateTime);
+    }
+    fractions.push_back(time / toSeconds(totalTime));
   }
-  return n == 0 ? 0.0 : sum / n;
-}
\ No newline at end of file
+  return fractions;
+}
+
+// Get the number of processes that migrated into the Ready Queue.
+long long StatisticsUnit::getMigrationsIn(int RQindex) {
+  return migrationsIn[RQindex];
+}
+
+// Get the number of processes that migrated out of the Ready Queue.
+long long StatisticsUnit::getMigrationsOut(int RQindex) {
+  return migrationsOut[RQindex];
+}
+
+// Get the average turnaround time of processes that finished on a CPU class,
+//   0 if none have.
+float StatisticsUnit::getClassAvgTurnTime(int classIndex) {
+  if (classProcessesDone[classIndex] == 0) return 0.0;
+  return classTurnTimes[classIndex] / classProcessesDone[classIndex];
+}
+
+// Get the throughput of a CPU class up to time totalTime.
+float StatisticsUnit::getClassThroughput(SimTime totalTime, int classIndex) {
+  return classProcessesDone[classIndex] / toSeconds(totalTime);
+}
+
+// Get the average utilization of the CPUs in a class up to time totalTime.
+float StatisticsUnit::getClassUtilization(SimTime totalTime, int classIndex) {
+  SimTime busyTime = SimTime();
+  int numCPUs = 0;
+  for (int i = 0; i < cpuList->getNumCPUs(); i++) {
+    if (cpuList->getCPUClass(i) == classIndex) {
+      busyTime += utilizationTimes[i];
+      numCPUs++;
+    }
+  }
+  return toSeconds(busyTime) / numCPUs / toSeconds(totalTime);
+}
+
+int StatisticsUnit::getNumProcessClasses() {
+  return processClassTotals.size();
+}
+
+// Get the number of processes of a workload class that have finished.
+long long StatisticsUnit::getProcessClassNumDone(int processClass) {
+  return processClassTotals[processClass].numDone;
+}
+
+// Get the average turnaround time of a workload class, 0 if none of its
+//   processes have finished (likewise for the other averages below).
+float StatisticsUnit::getProcessClassAvgTurnTime(int processClass) {
+  if (processClassTotals[processClass].numDone == 0) return 0.0;
+  return processClassTotals[processClass].turnTime / processClassTotals[processClass].numDone;
+}
+
+// Get the average time a workload class's processes spent not running.
+float StatisticsUnit::getProcessClassAvgWaitTime(int processClass) {
+  if (processClassTotals[processClass].numDone == 0) return 0.0;
+  return processClassTotals[processClass].waitTime / processClassTotals[processClass].numDone;
+}
+
+// Get the average slowdown (turnaround over service time) of a workload
+//   class. Processes with no service count as 1.
+float StatisticsUnit::getProcessClassAvgSlowdown(int processClass) {
+  if (processClassTotals[processClass].numDone == 0) return 0.0;
+  return processClassTotals[processClass].slowdown / processClassTotals[processClass].numDone;
+}
+
+// Get the throughput of a workload class up to time totalTime.
+float StatisticsUnit::getProcessClassThroughput(SimTime totalTime, int processClass) {
+  return processClassTotals[processClass].numDone / toSeconds(totalTime);
+}
+
+// Get the sketches of the turnaround, waiting and response times so far.
+QuantileSketch StatisticsUnit::getTurnTimeSketch() {
+  return turnTimes;
+}
+
+QuantileSketch StatisticsUnit::getWaitTimeSketch() {
+  return waitTimes;
+}
+
+QuantileSketch StatisticsUnit::getResponseTimeSketch() {
+  return responseTimes;
+}
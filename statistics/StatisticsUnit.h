@@ -1,9 +1,10 @@
 #ifndef STATISTICSUNIT_H
 #define STATISTICSUNIT_H
 
-#include "../processes/Process.h"
+#include "../processes/ProcessTable.h"
 #include "../processes/ReadyQueueList.h"
 #include "../processes/CPUList.h"
+#include "QuantileSketch.h"
 #include <vector>
 
 using namespace std;
@@ -11,34 +12,86 @@ using namespace std;
 // ====================================================================
 // Structure to track and calculate statistics about the simulation.
 // Tracks average turnaround time, throughput, utilization, and average
-//   number of processes in the Ready Queue. 
+//   number of processes in the Ready Queue. Ready Queue lengths are
+//   integrated over time exactly, using constant memory per queue.
+// Turnaround time, throughput and utilization are also broken down by the
+//   class of the CPU a process finished on, and turnaround time, waiting
+//   time, slowdown and throughput by the workload class of the process.
+// Turnaround, waiting and response times also go into quantile sketches
+//   for their percentiles.
 class StatisticsUnit {
   private:
+    ProcessTable *processes;
     CPUList *cpuList;
     ReadyQueueList *RQList;
 
-    float totalTurnTime;
-    float numProcessesDone;
-    vector<float> utilizationTimes;
+    double totalTurnTime;
+    long long numProcessesDone;
+    vector<double> classTurnTimes;      // Per CPU class
+    vector<long long> classProcessesDone;
+
+    // Totals per workload class, one contiguous entry per class id
+    struct ProcessClassTotals {
+      double turnTime;
+      double waitTime;      // Time not running: turnaround minus time on CPUs
+      double slowdown;      // Turnaround over service time
+      long long numDone;
+    };
+    vector<ProcessClassTotals> processClassTotals;
+
+    QuantileSketch turnTimes;
+    QuantileSketch waitTimes;
+    QuantileSketch responseTimes;   // Arrival to first time on a CPU
+
+    vector<SimTime> utilizationTimes;
+    vector<long long> migrationsIn;     // Per Ready Queue
+    vector<long long> migrationsOut;
   
     // Variables used for calculating avgProcessesInQ
-    struct queueSample;
-    vector<queueSample *> sampleHeads;
-    float sampleTimeDiff;
+    struct queueLengthTracker {
+      int length;                   // Length since lastUpdateTime
+      SimTime lastUpdateTime;
+      double lengthTimeIntegral;    // Integral of the length over [0, lastUpdateTime]
+      vector<double> timeAtLength;  // Time spent at each length, last bin is that length or more
+    };
+    vector<queueLengthTracker> RQTrackers;
+    int histogramBins;
   
   
   public:
-    StatisticsUnit(float, CPUList *, ReadyQueueList *);
-    ~StatisticsUnit();
+    StatisticsUnit(ProcessTable *, CPUList *, ReadyQueueList *, int = 0, int = 1, float = 0);
+
+    void setNumProcessClasses(int);
   
-    void processDone(Process *, float);
+    void processStarted(ProcessIndex, SimTime);
+    void processDone(ProcessIndex, SimTime);
+    void logRun(int, SimTime);
+    void logMigration(int, int);
 
-    void sampleRQueue(float, int);
+    void sampleRQueue(SimTime, int);
 
     float getAvgTurnTime();
-    float getThroughput(float);
-    float getUtilization(float, int = 0);
-    float getAvgProcessesInQ(float, int = 0);
+    float getThroughput(SimTime);
+    float getUtilization(SimTime, int = 0);
+    float getAvgProcessesInQ(SimTime, int = 0);
+    vector<float> getRQLengthDistribution(SimTime, int = 0);
+    long long getMigrationsIn(int = 0);
+    long long getMigrationsOut(int = 0);
+
+    float getClassAvgTurnTime(int);
+    float getClassThroughput(SimTime, int);
+    float getClassUtilization(SimTime, int);
+
+    int getNumProcessClasses();
+    long long getProcessClassNumDone(int);
+    float getProcessClassAvgTurnTime(int);
+    float getProcessClassAvgWaitTime(int);
+    float getProcessClassAvgSlowdown(int);
+    float getProcessClassThroughput(SimTime, int);
+
+    QuantileSketch getTurnTimeSketch();
+    QuantileSketch getWaitTimeSketch();
+    QuantileSketch getResponseTimeSketch();
 };
 
 #endif // STATISTICSUNIT_H
\ No newline at end of file
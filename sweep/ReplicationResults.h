@@ -0,0 +1,31 @@
+#ifndef REPLICATIONRESULTS_H
+#define REPLICATIONRESULTS_H
+
+#include "../statistics/ConfidenceInterval.h"
+#include "../statistics/QuantileSketch.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// 95% confidence intervals across independent replications of one
+//   simulation configuration.
+struct ReplicationResults {
+  int replications;
+  bool precisionReached;            // False if stopped at the replication limit
+
+  ConfidenceInterval avgTurnTime;
+  ConfidenceInterval throughput;
+  vector<ConfidenceInterval> utilization;       // Per CPU
+  vector<ConfidenceInterval> avgProcessesInQ;   // Per Ready Queue
+  // Per workload class, empty unless there are several. Each interval only
+  //   covers the replications in which the class finished a process, and
+  //   has an infinite half-width if fewer than 2 did.
+  vector<ConfidenceInterval> processClassAvgTurnTime;
+  vector<ConfidenceInterval> processClassAvgWaitTime;
+  QuantileSketch turnTimes;         // Merged over every replication, empty unless quantiles are on
+  QuantileSketch waitTimes;
+  QuantileSketch responseTimes;
+};
+
+#endif // REPLICATIONRESULTS_H
@@ -0,0 +1,105 @@
+#include "ReplicationRunner.h"
+#include "WorkStealingPool.h"
+#include "../simulation/Simulation.h"
+#include "../generators/SeedMixer.h"
+#include <algorithm>
+#include <ctime>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+ReplicationRunner::ReplicationRunner(const SimulationConfig &config, int waveSize, float targetPrecision, int maxReplications) {
+  if (waveSize < 2 || targetPrecision < 0 || maxReplications < waveSize) {
+    throw runtime_error("Invalid replication arguments.");
+  }
+
+  this->config = config;
+  this->config.histogramBins = 0;
+  this->waveSize = waveSize;
+  this->targetPrecision = targetPrecision;
+  this->maxReplications = maxReplications;
+  baseSeed = config.seed ? config.seed : time(0);
+}
+
+// Runs replications [first, first + count) and appends their metrics
+void ReplicationRunner::runWave(int first, int count, int numThreads) {
+  metrics.resize(first + count);
+
+  vector<int> order(count);
+  iota(order.begin(), order.end(), first);
+
+  WorkStealingPool pool(numThreads);
+  pool.run(order, [this](int i) {
+    SimulationConfig replicationConfig = config;
+    replicationConfig.seed = mixSeed(baseSeed, i);
+    Simulation simulation(replicationConfig);
+    metrics[i] = simulation.run();
+  });
+}
+
+ReplicationResults ReplicationRunner::summarize() {
+  ReplicationResults results;
+  results.replications = metrics.size();
+
+  vector<double> samples(metrics.size());
+  auto interval = [&](auto metric) {
+    for (int i = 0; i < metrics.size(); i++) {
+      samples[i] = metric(metrics[i]);
+    }
+    return ConfidenceInterval::fromSamples(samples);
+  };
+
+  results.avgTurnTime = interval([](const SimulationMetrics &m) { return m.avgTurnTime; });
+  results.throughput = interval([](const SimulationMetrics &m) { return m.throughput; });
+  for (int c = 0; c < metrics[0].utilization.size(); c++) {
+    results.utilization.push_back(interval([c](const SimulationMetrics &m) { return m.utilization[c]; }));
+  }
+  for (int q = 0; q < metrics[0].avgProcessesInQ.size(); q++) {
+    results.avgProcessesInQ.push_back(interval([q](const SimulationMetrics &m) { return m.avgProcessesInQ[q]; }));
+  }
+  // Replications where a workload class finished nothing have no average
+  //   for it, so they are left out of its intervals.
+  auto classInterval = [&](int c, auto metric) {
+    vector<double> classSamples;
+    for (const SimulationMetrics &m : metrics) {
+      if (m.processClassNumDone[c] > 0) classSamples.push_back(metric(m));
+    }
+    if (classSamples.size() < 2) {
+      return ConfidenceInterval{classSamples.empty() ? 0.0f : float(classSamples[0]), numeric_limits<float>::infinity()};
+    }
+    return ConfidenceInterval::fromSamples(classSamples);
+  };
+  for (int c = 0; c < metrics[0].processClassAvgTurnTime.size(); c++) {
+    results.processClassAvgTurnTime.push_back(classInterval(c, [c](const SimulationMetrics &m) { return m.processClassAvgTurnTime[c]; }));
+    results.processClassAvgWaitTime.push_back(classInterval(c, [c](const SimulationMetrics &m) { return m.processClassAvgWaitTime[c]; }));
+  }
+
+  results.turnTimes = metrics[0].turnTimes;
+  results.waitTimes = metrics[0].waitTimes;
+  results.responseTimes = metrics[0].responseTimes;
+  for (int i = 1; i < metrics.size(); i++) {
+    results.turnTimes.merge(metrics[i].turnTimes);
+    results.waitTimes.merge(metrics[i].waitTimes);
+    results.responseTimes.merge(metrics[i].responseTimes);
+  }
+
+  results.precisionReached = results.avgTurnTime.relativeHalfWidth() <= targetPrecision
+                          && results.throughput.relativeHalfWidth() <= targetPrecision;
+  return results;
+}
+
+ReplicationResults ReplicationRunner::run(int numThreads) {
+  metrics.clear();
+  runWave(0, waveSize, numThreads);
+  ReplicationResults results = summarize();
+
+  while (targetPrecision > 0 && !results.precisionReached && metrics.size() < maxReplications) {
+    runWave(metrics.size(), min(waveSize, maxReplications - (int)metrics.size()), numThreads);
+    results = summarize();
+  }
+
+  if (targetPrecision == 0) {
+    results.precisionReached = true;
+  }
+  return results;
+}
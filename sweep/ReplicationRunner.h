@@ -0,0 +1,38 @@
+#ifndef REPLICATIONRUNNER_H
+#define REPLICATIONRUNNER_H
+
+#include "ReplicationResults.h"
+#include "../simulation/SimulationConfig.h"
+#include "../simulation/SimulationMetrics.h"
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Runs independent replications of one configuration in parallel and
+//   reports 95% confidence intervals for its metrics.
+// Replications run in waves of a fixed size. With a target precision, more
+//   waves are run until the average turnaround time and throughput intervals
+//   are within that fraction of their means, or the replication limit is hit.
+// Replication i is always seeded the same way, so results do not depend on
+//   the number of threads.
+class ReplicationRunner {
+  private:
+    SimulationConfig config;
+    int waveSize;
+    float targetPrecision;        // Relative half-width, 0 = run a single wave
+    int maxReplications;
+    unsigned long long baseSeed;
+
+    vector<SimulationMetrics> metrics;
+
+    void runWave(int, int, int);
+    ReplicationResults summarize();
+
+  public:
+    ReplicationRunner(const SimulationConfig &, int waveSize, float targetPrecision = 0, int maxReplications = MAX_REPLICATIONS);
+
+    ReplicationResults run(int numThreads);
+};
+
+#endif // REPLICATIONRUNNER_H
@@ -0,0 +1,236 @@
+#include "SweepRunner.h"
+#include "WorkStealingPool.h"
+#include "../simulation/Simulation.h"
+#include "../generators/SeedMixer.h"
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+// Order in which grid parameters are nested, outermost first
+static const vector<string> GRID_KEYS = {
+  "arrivalRate", "serviceTime", "arrivalDistribution", "serviceDistribution", "processClasses", "scheduler", "quantum",
+  "mlfqLevels", "mlfqQuantum", "mlfqBoostPeriod", "rqSetup", "dispatcher", "dispatchChoices", "pushInterval", "pullMigration", "migrationCost", "numCPUs",
+  "cpuClasses", "affinities", "eventQueue", "endCondition", "N", "timeLimit"
+};
+
+static string trim(const string &s) {
+  size_t begin = s.find_first_not_of(" \t\r");
+  if (begin == string::npos) return "";
+  size_t end = s.find_last_not_of(" \t\r");
+  return s.substr(begin, end - begin + 1);
+}
+
+SweepRunner::SweepRunner(const string &gridFile) {
+  replications = 1;
+  baseSeed = RANDOM_SEED;
+
+  parseGrid(gridFile);
+
+  if (baseSeed == 0) {
+    baseSeed = time(0);
+  }
+
+  buildJobs();
+}
+
+int SweepRunner::getNumJobs() {
+  return jobs.size();
+}
+
+void SweepRunner::parseGrid(const string &gridFile) {
+  ifstream file(gridFile);
+  if (!file) {
+    throw runtime_error("Could not open sweep grid file " + gridFile + ".");
+  }
+
+  string line;
+  int lineNumber = 0;
+  while (getline(file, line)) {
+    lineNumber++;
+    line = trim(line.substr(0, line.find('#')));
+    if (line.empty()) continue;
+
+    size_t equals = line.find('=');
+    if (equals == string::npos) {
+      throw runtime_error("Missing '=' on line " + to_string(lineNumber) + " of the sweep grid.");
+    }
+    string key = trim(line.substr(0, equals));
+
+    vector<string> values;
+    stringstream valueStream(line.substr(equals + 1));
+    string value;
+    while (getline(valueStream, value, ',')) {
+      value = trim(value);
+      if (!value.empty()) values.push_back(value);
+    }
+    if (values.empty()) {
+      throw runtime_error("No values for " + key + " on line " + to_string(lineNumber) + " of the sweep grid.");
+    }
+
+    try {
+      if (key == "replications" || key == "seed") {
+        if (values.size() != 1) {
+          throw runtime_error(key + " takes a single value in the sweep grid.");
+        }
+        if (key == "replications") replications = stoi(values[0]);
+        else baseSeed = stoull(values[0]);
+      }
+      else if (find(GRID_KEYS.begin(), GRID_KEYS.end(), key) != GRID_KEYS.end()) {
+        if (key.find("Distribution") == string::npos && key != "processClasses"
+            && key != "cpuClasses" && key != "affinities") {
+          for (const string &v : values) stod(v);   // Reject non-numeric values early
+        }
+        grid[key] = values;
+      }
+      else {
+        throw runtime_error("Unknown sweep parameter " + key + ".");
+      }
+    }
+    catch (const logic_error &) {   // From stoi/stod
+      throw runtime_error("Invalid value for " + key + " on line " + to_string(lineNumber) + " of the sweep grid.");
+    }
+  }
+
+  if (replications < 1) {
+    throw runtime_error("Sweep replications must be at least 1.");
+  }
+}
+
+static void setParameter(SimulationConfig &config, const string &key, const string &value) {
+  if (key == "arrivalRate") config.arrivalLambda = stof(value);
+  else if (key == "serviceTime") config.serviceTimeAvg = stof(value);
+  else if (key == "arrivalDistribution") config.arrivalDistribution = value;
+  else if (key == "serviceDistribution") config.serviceDistribution = value;
+  else if (key == "processClasses") config.processClasses = value;
+  else if (key == "scheduler") config.schedulerType = stoi(value);
+  else if (key == "quantum") config.quantum = stof(value);
+  else if (key == "mlfqLevels") config.mlfqLevels = stoi(value);
+  else if (key == "mlfqQuantum") config.mlfqQuantum = stof(value);
+  else if (key == "mlfqBoostPeriod") config.mlfqBoostPeriod = stof(value);
+  else if (key == "rqSetup") config.rqSetup = stoi(value);
+  else if (key == "dispatcher") config.dispatcher = static_cast<DispatcherType>(stoi(value));
+  else if (key == "dispatchChoices") config.dispatchChoices = stoi(value);
+  else if (key == "pushInterval") config.pushInterval = stof(value);
+  else if (key == "pullMigration") config.pullMigration = stoi(value) != 0;
+  else if (key == "migrationCost") config.migrationCost = stof(value);
+  else if (key == "numCPUs") config.numCPUs = stoi(value);
+  else if (key == "cpuClasses") config.cpuClasses = value;
+  else if (key == "affinities") config.affinities = value;
+  else if (key == "eventQueue") config.eventQueueType = static_cast<EventQueueType>(stoi(value));
+  else if (key == "endCondition") config.endCondition = static_cast<EndCondition>(stoi(value));
+  else if (key == "N") config.N = stoi(value);
+  else if (key == "timeLimit") config.timeLimit = stof(value);
+}
+
+// Builds the Cartesian product of the grid, with the last key varying fastest
+//   and replications innermost
+void SweepRunner::buildJobs() {
+  vector<string> keys;
+  for (const string &key : GRID_KEYS) {
+    if (grid.count(key)) keys.push_back(key);
+  }
+
+  vector<int> choice(keys.size(), 0);
+  while (true) {
+    SimulationConfig config;
+    config.histogramBins = 0;
+    for (int k = 0; k < keys.size(); k++) {
+      setParameter(config, keys[k], grid[keys[k]][choice[k]]);
+    }
+    if (config.schedulerType == 4 && config.quantum == 0) {   // RR always needs a quantum
+      config.quantum = DEFAULT_RR_QUANTUM;
+    }
+    for (int r = 0; r < replications; r++) {
+      Job job;
+      job.config = config;
+      job.config.seed = mixSeed(baseSeed, jobs.size());
+      job.replication = r;
+      job.cost = estimateCost(config);
+      jobs.push_back(job);
+    }
+
+    int k = keys.size() - 1;
+    while (k >= 0 && ++choice[k] == grid[keys[k]].size()) {
+      choice[k] = 0;
+      k--;
+    }
+    if (k < 0) break;
+  }
+}
+
+// Number of processes the run will see, scaled up as the load approaches 1
+//   since queues (and the work per event) grow as 1/(1 - load)
+double SweepRunner::estimateCost(const SimulationConfig &config) {
+  double processes = config.endCondition == TIME_LIMIT
+    ? config.arrivalLambda * config.timeLimit
+    : config.N;
+  double load = config.arrivalLambda * config.serviceTimeAvg / max(config.numCPUs, 1);
+  double slack = max(1.0 - load, 0.01);
+  return processes * (1.0 + 1.0 / slack);
+}
+
+void SweepRunner::run(int numThreads) {
+  results.assign(jobs.size(), SimulationMetrics());
+
+  vector<int> order(jobs.size());
+  iota(order.begin(), order.end(), 0);
+  stable_sort(order.begin(), order.end(), [this](int a, int b) {
+    return jobs[a].cost > jobs[b].cost;
+  });
+
+  WorkStealingPool pool(numThreads);
+  pool.run(order, [this](int i) {
+    Simulation simulation(jobs[i].config);
+    results[i] = simulation.run();
+  });
+}
+
+void SweepRunner::writeResults(ostream &out) {
+  out << "arrivalRate,serviceTime,arrivalDistribution,serviceDistribution,processClasses,scheduler,quantum,mlfqLevels,mlfqQuantum,mlfqBoostPeriod,rqSetup,dispatcher,dispatchChoices,pushInterval,pullMigration,migrationCost,"
+      << "numCPUs,cpuClasses,affinities,eventQueue,endCondition,N,timeLimit,replication,seed,endTime,avgTurnTime,throughput,avgUtilization,avgProcessesInQ,migrations,processClassTurnTimes,p95TurnTime,p99TurnTime\n";
+
+  for (int i = 0; i < jobs.size(); i++) {
+    const SimulationConfig &c = jobs[i].config;
+    const SimulationMetrics &m = results[i];
+
+    float utilization = 0;
+    for (float u : m.utilization) utilization += u;
+    if (!m.utilization.empty()) utilization /= m.utilization.size();
+
+    float inQ = 0;
+    for (float q : m.avgProcessesInQ) inQ += q;
+
+    long long migrations = 0;
+    for (long long n : m.migrationsIn) migrations += n;
+
+    out << c.arrivalLambda << ',' << c.serviceTimeAvg << ',' << c.arrivalDistribution << ','
+        << c.serviceDistribution << ',' << c.processClasses << ',' << c.schedulerType << ',' << c.quantum << ','
+        << c.mlfqLevels << ',' << c.mlfqQuantum << ',' << c.mlfqBoostPeriod << ','
+        << c.rqSetup << ',' << static_cast<int>(c.dispatcher) << ',' << c.dispatchChoices << ',' << c.pushInterval << ',' << c.pullMigration << ',' << c.migrationCost << ','
+        << c.numCPUs << ',' << c.cpuClasses << ',' << c.affinities << ',' << static_cast<int>(c.eventQueueType) << ','
+        << static_cast<int>(c.endCondition) << ',' << c.N << ',' << c.timeLimit << ','
+        << jobs[i].replication << ',' << c.seed << ','
+        << m.endTime << ',' << m.avgTurnTime << ',' << m.throughput << ','
+        << utilization << ',' << inQ << ',' << migrations << ',';
+
+    // Semicolon-separated, empty with a single workload class. A class with
+    //   no processes done has an empty entry rather than an average of 0.
+    for (int k = 0; k < m.processClassAvgTurnTime.size(); k++) {
+      out << (k ? ";" : "");
+      if (m.processClassNumDone[k] > 0) out << m.processClassAvgTurnTime[k];
+    }
+    out << ',';
+
+    // Empty with quantiles off
+    if (m.turnTimes.isEnabled()) {
+      out << m.turnTimes.getQuantile(0.95) << ',' << m.turnTimes.getQuantile(0.99);
+    }
+    else {
+      out << ',';
+    }
+    out << '\n';
+  }
+}
@@ -0,0 +1,56 @@
+#ifndef SWEEPRUNNER_H
+#define SWEEPRUNNER_H
+
+#include "../simulation/SimulationConfig.h"
+#include "../simulation/SimulationMetrics.h"
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Runs every combination of a grid of simulation parameters, several
+//   replications each, on a work stealing thread pool.
+// The grid is read from a text file with one parameter per line:
+//     # comment
+//     arrivalRate = 0.5, 0.9, 0.99
+//     scheduler = 0, 1, 2, 3, 4, 5
+//     replications = 10
+// Parameters not in the file keep their defaults from config.h.
+// Every job gets its own seed derived from the base seed and its position in
+//   the grid, so results do not depend on the number of threads.
+class SweepRunner {
+  private:
+    struct Job {
+      SimulationConfig config;
+      int replication;
+      double cost;            // Rough estimate of the run time, for scheduling
+    };
+
+    map<string, vector<string>> grid;
+    int replications;
+    unsigned long long baseSeed;
+
+    vector<Job> jobs;
+    vector<SimulationMetrics> results;
+
+    void parseGrid(const string &);
+    void buildJobs();
+
+    static double estimateCost(const SimulationConfig &);
+
+  public:
+    SweepRunner(const string &gridFile);
+
+    int getNumJobs();
+
+    // Runs all jobs with the given number of threads (0 = one per hardware thread)
+    void run(int numThreads);
+
+    // Writes one CSV row per job, in grid order
+    void writeResults(ostream &);
+};
+
+#endif // SWEEPRUNNER_H
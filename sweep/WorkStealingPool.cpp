@@ -0,0 +1,75 @@
+#include "WorkStealingPool.h"
+#include <atomic>
+#include <exception>
+#include <thread>
+
+// numThreads <= 0 uses one thread per hardware thread.
+WorkStealingPool::WorkStealingPool(int numThreads) {
+  if (numThreads <= 0) {
+    numThreads = thread::hardware_concurrency();
+  }
+  this->numThreads = numThreads > 0 ? numThreads : 1;
+}
+
+int WorkStealingPool::getNumThreads() {
+  return numThreads;
+}
+
+// Takes the next job from worker self's own deque, or steals one from another
+//   worker. Returns false once every deque is empty.
+bool WorkStealingPool::takeJob(vector<Worker> &workers, int self, int &jobIndex) {
+  {
+    lock_guard<mutex> guard(workers[self].lock);
+    if (!workers[self].jobs.empty()) {
+      jobIndex = workers[self].jobs.front();
+      workers[self].jobs.pop_front();
+      return true;
+    }
+  }
+  for (int i = 1; i < (int)workers.size(); i++) {
+    Worker &victim = workers[(self + i) % workers.size()];
+    lock_guard<mutex> guard(victim.lock);
+    if (!victim.jobs.empty()) {
+      jobIndex = victim.jobs.back();
+      victim.jobs.pop_back();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingPool::run(const vector<int> &order, const function<void(int)> &job) {
+  vector<Worker> workers(numThreads);
+  for (int i = 0; i < (int)order.size(); i++) {     // Deal jobs out round-robin
+    workers[i % numThreads].jobs.push_back(order[i]);
+  }
+
+  exception_ptr firstError = nullptr;
+  mutex errorLock;
+  atomic<bool> failed(false);
+
+  auto work = [&](int self) {
+    int jobIndex;
+    while (!failed && takeJob(workers, self, jobIndex)) {
+      try {
+        job(jobIndex);
+      }
+      catch (...) {
+        lock_guard<mutex> guard(errorLock);
+        if (!firstError) firstError = current_exception();
+        failed = true;
+      }
+    }
+  };
+
+  vector<thread> threads;
+  for (int i = 1; i < numThreads; i++) {
+    threads.push_back(thread(work, i));
+  }
+  work(0);
+  for (thread &t : threads) {
+    t.join();
+  }
+
+  if (firstError) rethrow_exception(firstError);
+}
@@ -0,0 +1,39 @@
+#ifndef WORKSTEALINGPOOL_H
+#define WORKSTEALINGPOOL_H
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Thread pool that runs a fixed set of independent jobs.
+// Every worker has its own deque of job indices. A worker takes jobs from
+//   the front of its own deque and, once that is empty, steals from the
+//   back of another worker's deque, so long and short jobs even out across
+//   threads without a shared queue becoming a bottleneck.
+class WorkStealingPool {
+  private:
+    struct Worker {
+      deque<int> jobs;
+      mutex lock;
+    };
+
+    int numThreads;
+
+    bool takeJob(vector<Worker> &, int, int &);
+
+  public:
+    WorkStealingPool(int);
+
+    int getNumThreads();
+
+    // Runs job(i) for every index in order, which should be sorted by
+    //   decreasing expected cost, and blocks until all have finished.
+    // Rethrows the first exception thrown by a job, after all workers stop.
+    void run(const vector<int> &order, const function<void(int)> &job);
+};
+
+#endif // WORKSTEALINGPOOL_H
@@ -0,0 +1,31 @@
+#ifndef TRACEFORMAT_H
+#define TRACEFORMAT_H
+
+#include <cstdint>
+
+using namespace std;
+
+// ====================================================================
+// Binary trace file layout: a TraceHeader followed by numRecords
+//   TraceRecords sorted by arrival time, all in native (little-endian)
+//   byte order. Create trace files with /traces/traceConverter.
+const char TRACE_MAGIC[8] = {'D', 'T', 'E', 'S', 'T', 'R', 'C', '1'};
+const uint32_t TRACE_VERSION = 1;
+
+struct TraceHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t recordSize;      // sizeof(TraceRecord), guards against layout changes
+  uint64_t numRecords;
+};
+
+struct TraceRecord {
+  double arrivalTime;       // Absolute time (seconds)
+  float serviceTime;        // Seconds
+  uint32_t processClass;    // Workload class, 0 if the trace has none
+};
+
+static_assert(sizeof(TraceHeader) == 24, "Unexpected TraceHeader layout");
+static_assert(sizeof(TraceRecord) == 16, "Unexpected TraceRecord layout");
+
+#endif // TRACEFORMAT_H
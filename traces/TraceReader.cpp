@@ -0,0 +1,143 @@
+#include "TraceReader.h"
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Reads and checks the header, then maps the records (or falls back to reads).
+TraceReader::TraceReader(const string &fileName) {
+  this->fileName = fileName;
+  nextRecord = 0;
+  lastArrivalTime = 0;
+  mapping = nullptr;
+  mappingSize = 0;
+  records = nullptr;
+  nextWindow = 0;
+  bufferPos = 0;
+
+  file.open(fileName, ios::binary);
+  if (!file) {
+    throw runtime_error("Could not open trace file " + fileName + ".");
+  }
+
+  TraceHeader header;
+  if (!file.read(reinterpret_cast<char *>(&header), sizeof(header))
+      || memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0) {
+    throw runtime_error(fileName + " is not a trace file.");
+  }
+  if (header.version != TRACE_VERSION || header.recordSize != sizeof(TraceRecord)) {
+    throw runtime_error(fileName + " has an unsupported trace version.");
+  }
+  numRecords = header.numRecords;
+
+  file.seekg(0, ios::end);
+  if (uint64_t(file.tellg()) < sizeof(TraceHeader) + numRecords * sizeof(TraceRecord)) {
+    throw runtime_error(fileName + " is shorter than its header says.");
+  }
+  file.seekg(sizeof(TraceHeader));
+
+  if (mapFile()) {
+    file.close();
+  }
+}
+
+TraceReader::~TraceReader() {
+#ifndef _WIN32
+  if (mapping) {
+    munmap(const_cast<char *>(mapping), mappingSize);
+  }
+#endif
+}
+
+// Maps the whole file read-only. Returns false if mapping is unavailable.
+bool TraceReader::mapFile() {
+#ifdef _WIN32
+  return false;
+#else
+  int fd = open(fileName.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+
+  mappingSize = sizeof(TraceHeader) + numRecords * sizeof(TraceRecord);
+  void *address = mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);      // The mapping stays valid
+  if (address == MAP_FAILED) {
+    mappingSize = 0;
+    return false;
+  }
+
+  mapping = static_cast<const char *>(address);
+  records = reinterpret_cast<const TraceRecord *>(mapping + sizeof(TraceHeader));
+  madvise(address, mappingSize, MADV_SEQUENTIAL);
+  advanceWindow(0);
+  return true;
+#endif
+}
+
+// Called when reading reaches byte offset. Once it enters a new window, asks
+//   the kernel to read the window after it and drops the window before it.
+void TraceReader::advanceWindow(size_t offset) {
+#ifndef _WIN32
+  while (offset >= nextWindow && nextWindow < mappingSize) {
+    size_t ahead = nextWindow + WINDOW_BYTES;
+    if (ahead < mappingSize) {
+      size_t length = mappingSize - ahead;
+      if (length > WINDOW_BYTES) length = WINDOW_BYTES;
+      madvise(const_cast<char *>(mapping) + ahead, length, MADV_WILLNEED);
+    }
+    if (nextWindow >= 2 * WINDOW_BYTES) {
+      madvise(const_cast<char *>(mapping) + nextWindow - 2 * WINDOW_BYTES, WINDOW_BYTES, MADV_DONTNEED);
+    }
+    nextWindow += WINDOW_BYTES;
+  }
+#endif
+}
+
+// Returns the next record, or nullptr at the end of the trace.
+const TraceRecord *TraceReader::readRecord() {
+  if (nextRecord >= numRecords) return nullptr;
+
+  if (records) {
+    size_t offset = sizeof(TraceHeader) + (nextRecord + 1) * sizeof(TraceRecord);
+    if (offset >= nextWindow) advanceWindow(offset);
+    return &records[nextRecord++];
+  }
+
+  if (bufferPos == buffer.size()) {
+    int count = BUFFER_RECORDS;
+    if (numRecords - nextRecord < count) count = numRecords - nextRecord;
+    buffer.resize(count);
+    if (!file.read(reinterpret_cast<char *>(buffer.data()), count * sizeof(TraceRecord))) {
+      throw runtime_error("Error reading trace file " + fileName + ".");
+    }
+    bufferPos = 0;
+  }
+  nextRecord++;
+  return &buffer[bufferPos++];
+}
+
+uint64_t TraceReader::getNumRecords() {
+  return numRecords;
+}
+
+bool TraceReader::next(SimTime &arrivalTime, SimTime &serviceTime, uint32_t &processClass) {
+  const TraceRecord *record = readRecord();
+  if (!record) return false;
+
+  if (!(record->arrivalTime >= lastArrivalTime) || isinf(record->arrivalTime)
+      || !(record->serviceTime >= 0) || isinf(record->serviceTime)) {
+    throw runtime_error("Invalid record " + to_string(nextRecord - 1) + " in trace file " + fileName
+                        + " (arrival times must be sorted and times non-negative).");
+  }
+  lastArrivalTime = record->arrivalTime;
+
+  arrivalTime = fromSeconds(record->arrivalTime);
+  serviceTime = fromSeconds(record->serviceTime);
+  processClass = record->processClass;
+  return true;
+}
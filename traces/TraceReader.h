@@ -0,0 +1,55 @@
+#ifndef TRACEREADER_H
+#define TRACEREADER_H
+
+#include "TraceFormat.h"
+#include "../generators/ArrivalSource.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// ====================================================================
+// Replays arrivals from a binary trace file (see TraceFormat.h).
+// On POSIX systems the file is memory-mapped and read front to back. Pages
+//   ahead of the current record are prefetched and pages behind it are
+//   released, so memory use stays flat however long the trace is. Elsewhere,
+//   or if mapping fails, records are read through a fixed-size buffer.
+class TraceReader : public ArrivalSource {
+  private:
+    static const size_t WINDOW_BYTES = 8 << 20;      // Prefetch/release granularity
+    static const int BUFFER_RECORDS = 1 << 16;       // Fallback read size
+
+    string fileName;
+    uint64_t numRecords;
+    uint64_t nextRecord;
+    double lastArrivalTime;
+
+    // Memory-mapped path
+    const char *mapping;
+    size_t mappingSize;
+    const TraceRecord *records;
+    size_t nextWindow;          // Start of the next window to prefetch
+
+    // Buffered fallback path
+    ifstream file;
+    vector<TraceRecord> buffer;
+    int bufferPos;
+
+    bool mapFile();
+    void advanceWindow(size_t);
+    const TraceRecord *readRecord();
+
+  public:
+    TraceReader(const string &);
+    ~TraceReader();
+
+    TraceReader(const TraceReader &) = delete;
+    TraceReader &operator=(const TraceReader &) = delete;
+
+    uint64_t getNumRecords();
+
+    bool next(SimTime &, SimTime &, uint32_t &);
+};
+
+#endif // TRACEREADER_H
@@ -0,0 +1,92 @@
+#include "../TraceFormat.h"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Converts a CSV trace into the binary trace format read by the simulator.
+// Each line is "arrivalTime, serviceTime" or "arrivalTime, serviceTime, class",
+//   with arrival times in seconds and sorted. A header line and lines
+//   starting with # are skipped.
+// Usage: ./traceConverter <input.csv> <output.trace>
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    cerr << "Usage: " << argv[0] << " <input.csv> <output.trace>" << endl;
+    return 1;
+  }
+
+  ifstream in(argv[1]);
+  if (!in) {
+    cerr << "Could not open " << argv[1] << endl;
+    return 1;
+  }
+  ofstream out(argv[2], ios::binary);
+  if (!out) {
+    cerr << "Could not open " << argv[2] << " for writing" << endl;
+    return 1;
+  }
+
+  // The record count is filled in once all records are written
+  TraceHeader header;
+  memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+  header.version = TRACE_VERSION;
+  header.recordSize = sizeof(TraceRecord);
+  header.numRecords = 0;
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  const int BUFFER_RECORDS = 1 << 16;
+  vector<TraceRecord> buffer;
+  buffer.reserve(BUFFER_RECORDS);
+
+  string line;
+  long long lineNumber = 0;
+  double lastArrival = 0;
+  while (getline(in, line)) {
+    lineNumber++;
+    if (line.empty() || line[0] == '#') continue;
+    for (char &ch : line) {
+      if (ch == ',') ch = ' ';
+    }
+
+    stringstream lineStream(line);
+    TraceRecord record;
+    record.processClass = 0;
+    if (!(lineStream >> record.arrivalTime >> record.serviceTime)) {
+      if (header.numRecords == 0 && buffer.empty()) continue;    // Header line
+      cerr << "Invalid record on line " << lineNumber << endl;
+      return 1;
+    }
+    lineStream >> record.processClass;
+
+    if (record.arrivalTime < lastArrival || record.serviceTime < 0
+        || isinf(record.arrivalTime) || isinf(record.serviceTime)) {
+      cerr << "Invalid record on line " << lineNumber << " (arrival times must be sorted and times non-negative)" << endl;
+      return 1;
+    }
+    lastArrival = record.arrivalTime;
+
+    buffer.push_back(record);
+    if (buffer.size() == BUFFER_RECORDS) {
+      out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(TraceRecord));
+      header.numRecords += buffer.size();
+      buffer.clear();
+    }
+  }
+  out.write(reinterpret_cast<const char *>(buffer.data()), buffer.size() * sizeof(TraceRecord));
+  header.numRecords += buffer.size();
+
+  out.seekp(0);
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  if (!out) {
+    cerr << "Error writing " << argv[2] << endl;
+    return 1;
+  }
+
+  cout << "Wrote " << header.numRecords << " records to " << argv[2] << endl;
+  return 0;
+}